@@ -0,0 +1,170 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_runtime.h"
+#include "../include/fluxion_node.h"
+#include "../include/fluxion_async.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* ============================================================================
+ * FLUXION — ASYNC NODE BENCHMARK
+ *
+ * A source feeds a compute chain of BENCH_STAGES nodes (BENCH_WORK_NS
+ * each) and a sink that blocks BENCH_IO_NS per write, as a disk flush
+ * would. With a plain sink every pulse waits for the write; with an
+ * async sink the pulse only submits it, and the writes of successive
+ * pulses overlap with the compute of the next ones.
+ *
+ * The submit case feeds pulse-arena messages to an async node whose
+ * first job of each round waits on a gate: the other jobs queue in
+ * its backlog without waking a worker, so the measured pulses cost a
+ * submission (job and input copy) and little else.
+ * ============================================================================
+ */
+
+#define BENCH_PULSES  2000
+#define BENCH_STAGES  4
+#define BENCH_WORK_NS 2000
+#define BENCH_IO_NS   100000
+
+#define BENCH_ROUNDS    100
+#define BENCH_BACKLOG   1000    // Submissions per round
+#define BENCH_MSG_BYTES 256
+
+static int bench_gate;
+
+static void bench_work(void) {
+    uint64_t end = fluxion_time_ns() + BENCH_WORK_NS;
+    while (fluxion_time_ns() < end) {}
+}
+
+static void bench_io(void) {
+    struct timespec ts = { 0, BENCH_IO_NS };
+    nanosleep(&ts, NULL);
+}
+
+FLUX_NODE(Source) {
+    (void)self;
+    (void)data;
+}
+
+FLUX_NODE(Work) {
+    (void)self;
+    (void)data;
+    bench_work();
+}
+
+FLUX_NODE(SyncSink) {
+    (void)data;
+    bench_io();
+    (*(uint64_t*)self->state)++;
+}
+
+FLUX_ASYNC_NODE(AsyncSink) {
+    (void)data;
+    bench_io();
+    (*(uint64_t*)self->state)++;
+    return FLUXION_NO_OUTPUT;
+}
+
+FLUX_ASYNC_NODE(Gated) {
+    (void)self;
+    (void)data;
+    struct timespec ts = { 0, 50000 };
+    while (!__atomic_load_n(&bench_gate, __ATOMIC_ACQUIRE)) nanosleep(&ts, NULL);
+    return FLUXION_NO_OUTPUT;
+}
+
+static int cmp_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+static void bench_run(const char* label, int async) {
+    FluxionContext ctx = fluxion_init();
+
+    Node source, stages[BENCH_STAGES], sink;
+    NODE_INIT(source, Source, "int");
+    for (int i = 0; i < BENCH_STAGES; i++) NODE_INIT(stages[i], Work, "int");
+    if (async) ASYNC_NODE_INIT(sink, AsyncSink, "int");
+    else NODE_INIT(sink, SyncSink, "int");
+
+    uint64_t writes = 0;
+    fluxion_node_set_state(&sink, &writes, sizeof(writes));
+
+    Node* prev = &source;
+    for (int i = 0; i < BENCH_STAGES; i++) {
+        fluxion_link(prev, &stages[i]);
+        prev = &stages[i];
+    }
+    fluxion_link(&source, &sink);
+
+    uint64_t* pulse_ns = malloc(sizeof(uint64_t) * BENCH_PULSES);
+    if (!pulse_ns) exit(1);
+
+    int value = 1;
+    uint64_t start = fluxion_time_ns();
+    for (int i = 0; i < BENCH_PULSES; i++) {
+        uint64_t t0 = fluxion_time_ns();
+        fluxion_emit(&ctx, &source, &value);
+        fluxion_pulse(&ctx, NULL, 0);
+        pulse_ns[i] = fluxion_time_ns() - t0;
+    }
+    fluxion_async_wait(&ctx);
+    double elapsed = (double)(fluxion_time_ns() - start);
+
+    qsort(pulse_ns, BENCH_PULSES, sizeof(uint64_t), cmp_u64);
+    printf("%-6s sink: %8.0f pulses/s  pulse p50=%7.1fus p99=%7.1fus  writes=%llu\n",
+           label,
+           BENCH_PULSES / (elapsed / 1e9),
+           pulse_ns[BENCH_PULSES / 2] / 1000.0,
+           pulse_ns[BENCH_PULSES * 99 / 100] / 1000.0,
+           (unsigned long long)*(uint64_t*)sink.state);
+
+    free(pulse_ns);
+    fluxion_node_cleanup(&source);
+    for (int i = 0; i < BENCH_STAGES; i++) fluxion_node_cleanup(&stages[i]);
+    fluxion_node_cleanup(&sink);
+    fluxion_cleanup(&ctx);
+}
+
+static void bench_submit(void) {
+    FluxionContext ctx = fluxion_init();
+
+    Node sink;
+    ASYNC_NODE_INIT(sink, Gated, "bytes");
+
+    uint64_t elapsed = 0;
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        __atomic_store_n(&bench_gate, 0, __ATOMIC_RELEASE);
+
+        uint64_t t0 = fluxion_time_ns();
+        for (int i = 0; i < BENCH_BACKLOG; i++) {
+            unsigned char* msg = fluxion_msg_alloc(&ctx, BENCH_MSG_BYTES);
+            if (!msg) break;
+            msg[0] = (unsigned char)i;
+
+            fluxion_emit(&ctx, &sink, msg);
+            fluxion_pulse(&ctx, NULL, 0);
+        }
+        elapsed += fluxion_time_ns() - t0;
+
+        __atomic_store_n(&bench_gate, 1, __ATOMIC_RELEASE);
+        fluxion_async_wait(&ctx);
+    }
+
+    FluxionAsyncStats stats = fluxion_async_stats(&ctx);
+    printf("submit %d B: %8.1f ns/pulse  delivered=%llu\n", BENCH_MSG_BYTES,
+           (double)elapsed / ((double)BENCH_ROUNDS * BENCH_BACKLOG), (unsigned long long)stats.delivered);
+
+    fluxion_node_cleanup(&sink);
+    fluxion_cleanup(&ctx);
+}
+
+int main(void) {
+    bench_run("sync", 0);
+    bench_run("async", 1);
+    bench_submit();
+    return 0;
+}
@@ -0,0 +1,104 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_runtime.h"
+#include "../include/fluxion_node.h"
+#include "../include/fluxion_builder.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* ============================================================================
+ * FLUXION — GRAPH CONSTRUCTION BENCHMARK
+ *
+ * Measures the time to build and tear down wide fan-outs
+ * (BENCH_SOURCES sources x BENCH_FANOUT subscribers), edge by edge
+ * and through the bulk builder. The edge-by-edge teardown shifts the
+ * subscriber array on every removal, so it only runs on one source.
+ * ============================================================================
+ */
+
+#define BENCH_SOURCES 100
+#define BENCH_FANOUT  10000
+#define BENCH_NODES   (BENCH_SOURCES + BENCH_FANOUT)
+#define BENCH_EDGES   ((size_t)BENCH_SOURCES * BENCH_FANOUT)
+
+FLUX_NODE(Noop) {
+    (void)self;
+    (void)data;
+}
+
+static double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void bench_report(const char* label, size_t edges, double elapsed) {
+    printf("%-18s edges=%zu ms=%.2f ns/edge=%.2f\n",
+           label, edges, elapsed * 1e3, elapsed * 1e9 / (double)edges);
+}
+
+static void bench_reset(Node* nodes) {
+    for (size_t i = 0; i < BENCH_NODES; i++) {
+        fluxion_node_cleanup(&nodes[i]);
+        NODE_INIT(nodes[i], Noop, "int");
+        nodes[i].uid = (uint32_t)i + 1;
+    }
+}
+
+int main(void) {
+    Node* nodes = NULL;
+    if (posix_memalign((void**)&nodes, FLUXION_NODE_ALIGN, sizeof(Node) * BENCH_NODES) != 0) return 1;
+    memset(nodes, 0, sizeof(Node) * BENCH_NODES);
+    Node** graph = malloc(sizeof(Node*) * BENCH_NODES);
+    FluxionEdge* edges = malloc(sizeof(FluxionEdge) * BENCH_EDGES);
+    if (!nodes || !graph || !edges) return 1;
+
+    for (size_t i = 0; i < BENCH_NODES; i++) graph[i] = &nodes[i];
+    for (size_t s = 0; s < BENCH_SOURCES; s++) {
+        for (size_t k = 0; k < BENCH_FANOUT; k++) {
+            edges[s * BENCH_FANOUT + k].src = (uint32_t)s + 1;
+            edges[s * BENCH_FANOUT + k].dst = (uint32_t)(BENCH_SOURCES + k) + 1;
+        }
+    }
+
+    /* --- Edge by edge: fluxion_link() --- */
+    bench_reset(nodes);
+    double t0 = bench_now();
+    for (size_t e = 0; e < BENCH_EDGES; e++) {
+        fluxion_link(&nodes[edges[e].src - 1], &nodes[edges[e].dst - 1]);
+    }
+    bench_report("link", BENCH_EDGES, bench_now() - t0);
+
+    /* --- Edge by edge teardown, first source only --- */
+    t0 = bench_now();
+    for (size_t k = 0; k < BENCH_FANOUT; k++) {
+        fluxion_node_unlink(&nodes[0], &nodes[BENCH_SOURCES + k]);
+    }
+    bench_report("node_unlink", BENCH_FANOUT, bench_now() - t0);
+
+    /* --- Bulk: builder index + edge list --- */
+    bench_reset(nodes);
+    t0 = bench_now();
+    FluxionBuilder* b = fluxion_builder_create(BENCH_NODES);
+    if (!b) return 1;
+    fluxion_builder_add_nodes(b, graph, BENCH_NODES);
+    fluxion_builder_link_bulk(b, edges, BENCH_EDGES);
+    bench_report("builder_bulk", BENCH_EDGES, bench_now() - t0);
+
+    /* --- Teardown: O(1) unlink through the edge index --- */
+    t0 = bench_now();
+    for (size_t e = 0; e < BENCH_EDGES; e++) {
+        fluxion_builder_unlink(b, edges[e].src, edges[e].dst);
+    }
+    bench_report("builder_unlink", BENCH_EDGES, bench_now() - t0);
+
+    fluxion_builder_destroy(b);
+    for (size_t i = 0; i < BENCH_NODES; i++) fluxion_node_cleanup(&nodes[i]);
+    free(edges);
+    free(graph);
+    free(nodes);
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_runtime.h"
+#include "../include/fluxion_node.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* ============================================================================
+ * FLUXION — DATAFLOW PRUNING BENCHMARK
+ *
+ * A router fans out to BENCH_BRANCHES filters, each heading a chain of
+ * BENCH_DEPTH processing nodes. A filter accepts one value in
+ * BENCH_BRANCHES, so a pulse is relevant to a single branch. Under
+ * FLUXION_EXEC_DEFERRED every chain runs on every pulse; under
+ * FLUXION_EXEC_DATAFLOW the rejected branches are pruned.
+ * ============================================================================
+ */
+
+#define BENCH_ITEMS    20000
+#define BENCH_BRANCHES 16
+#define BENCH_DEPTH    8
+#define BENCH_WORK     50
+
+static double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t bench_spin(uint64_t seed, int rounds) {
+    volatile uint64_t x = seed;
+    for (int i = 0; i < rounds; i++) x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    return x;
+}
+
+FLUX_NODE(Router) { (void)self; (void)data; }
+
+FLUX_FLOW_NODE(Filter) {
+    uint32_t branch = *(const uint32_t*)self->state;
+    return *(const uint32_t*)data % BENCH_BRANCHES == branch ? data : FLUXION_NO_OUTPUT;
+}
+
+FLUX_NODE(Stage) { (void)self; bench_spin(*(const uint32_t*)data, BENCH_WORK); }
+
+static Node router;
+static Node filters[BENCH_BRANCHES];
+static Node stages[BENCH_BRANCHES][BENCH_DEPTH];
+
+static void bench_build(void) {
+    NODE_INIT(router, Router, "uint32_t");
+    for (uint32_t b = 0; b < BENCH_BRANCHES; b++) {
+        FLOW_NODE_INIT(filters[b], Filter, "uint32_t");
+        fluxion_node_set_state(&filters[b], &b, sizeof(b));
+        fluxion_link(&router, &filters[b]);
+
+        Node* prev = &filters[b];
+        for (size_t d = 0; d < BENCH_DEPTH; d++) {
+            NODE_INIT(stages[b][d], Stage, "uint32_t");
+            fluxion_link(prev, &stages[b][d]);
+            prev = &stages[b][d];
+        }
+    }
+}
+
+static void bench_teardown(void) {
+    fluxion_node_cleanup(&router);
+    for (size_t b = 0; b < BENCH_BRANCHES; b++) {
+        fluxion_node_cleanup(&filters[b]);
+        for (size_t d = 0; d < BENCH_DEPTH; d++) fluxion_node_cleanup(&stages[b][d]);
+    }
+}
+
+static void bench_run(FluxionExecPolicy policy, const uint32_t* items) {
+    FluxionContext ctx = fluxion_init();
+    fluxion_set_policy(&ctx, policy);
+
+    double start = bench_now();
+    for (uint32_t i = 0; i < BENCH_ITEMS; i++) {
+        fluxion_emit(&ctx, &router, (void*)&items[i]);
+        fluxion_pulse(&ctx, NULL, 0);
+    }
+    double elapsed = bench_now() - start;
+
+    printf("%-9s items=%d executed/pulse=%.1f ns/item=%.0f\n",
+           fluxion_policy_name(policy), BENCH_ITEMS,
+           (double)ctx.executed_nodes / BENCH_ITEMS, elapsed * 1e9 / BENCH_ITEMS);
+    fluxion_cleanup(&ctx);
+}
+
+int main(void) {
+    uint32_t* items = malloc(sizeof(uint32_t) * BENCH_ITEMS);
+    if (!items) return 1;
+    for (uint32_t i = 0; i < BENCH_ITEMS; i++) items[i] = i;
+
+    bench_build();
+    bench_run(FLUXION_EXEC_DEFERRED, items);
+    bench_run(FLUXION_EXEC_DATAFLOW, items);
+    bench_teardown();
+
+    free(items);
+    return 0;
+}
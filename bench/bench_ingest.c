@@ -0,0 +1,189 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_runtime.h"
+#include "../include/fluxion_node.h"
+#include "../include/fluxion_ingest.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* ============================================================================
+ * FLUXION — INGESTION CONTENTION BENCHMARK
+ *
+ * 1 to 32 producer threads feed BENCH_ITEMS emissions into one context,
+ * either through the lock-free ingestion queue (drained into pulses by
+ * the main thread) or through a mutex around fluxion_emit() and
+ * fluxion_pulse(). Each emission reaches a source and its subscriber.
+ * ============================================================================
+ */
+
+#define BENCH_ITEMS   400000
+#define BENCH_TARGETS 16
+
+static uint64_t bench_sum = 0;
+
+FLUX_NODE(Source) {
+    (void)self;
+    bench_sum += *(const uint32_t*)data;
+}
+
+FLUX_NODE(Sink) {
+    (void)self;
+    (void)data;
+}
+
+static double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void bench_report(const char* label, unsigned producers, double elapsed) {
+    printf("%-8s producers=%-2u items=%d items/sec=%.3e ns/item=%.1f\n",
+           label, producers, BENCH_ITEMS,
+           (double)BENCH_ITEMS / elapsed, elapsed * 1e9 / BENCH_ITEMS);
+}
+
+static Node sources[BENCH_TARGETS];
+static Node sinks[BENCH_TARGETS];
+static const uint32_t payload = 1;
+
+typedef struct {
+    unsigned index;
+    unsigned producers;
+    FluxionIngest* queue;
+    FluxionContext* ctx;
+    pthread_mutex_t* lock;
+} BenchProducer;
+
+static size_t bench_share(const BenchProducer* p) {
+    return BENCH_ITEMS / p->producers + (p->index < BENCH_ITEMS % p->producers ? 1 : 0);
+}
+
+/* ============================================================================
+ * LOCK-FREE QUEUE
+ * ============================================================================
+ */
+
+static void* bench_queue_producer(void* arg) {
+    BenchProducer* p = arg;
+    size_t share = bench_share(p);
+
+    for (size_t i = 0; i < share; i++) {
+        Node* target = &sources[(p->index + i) % BENCH_TARGETS];
+        fluxion_ingest_push(p->queue, target, (void*)&payload);
+    }
+    return NULL;
+}
+
+typedef struct {
+    pthread_t* threads;
+    unsigned count;
+    FluxionIngest* queue;
+} BenchCloser;
+
+static void* bench_queue_closer(void* arg) {
+    BenchCloser* c = arg;
+    for (unsigned i = 0; i < c->count; i++) pthread_join(c->threads[i], NULL);
+    fluxion_ingest_close(c->queue);
+    return NULL;
+}
+
+static double bench_queue(unsigned producers) {
+    FluxionContext ctx = fluxion_init();
+    FluxionIngest* queue = fluxion_ingest_create(NULL);
+    pthread_t* threads = malloc(sizeof(pthread_t) * producers);
+    BenchProducer* args = malloc(sizeof(BenchProducer) * producers);
+    if (!queue || !threads || !args) exit(1);
+
+    double start = bench_now();
+
+    for (unsigned i = 0; i < producers; i++) {
+        args[i] = (BenchProducer){ i, producers, queue, NULL, NULL };
+        pthread_create(&threads[i], NULL, bench_queue_producer, &args[i]);
+    }
+
+    BenchCloser closer = { threads, producers, queue };
+    pthread_t closer_thread;
+    pthread_create(&closer_thread, NULL, bench_queue_closer, &closer);
+
+    size_t drained = fluxion_ingest_run(&ctx, queue);
+    pthread_join(closer_thread, NULL);
+
+    double elapsed = bench_now() - start;
+    if (drained != BENCH_ITEMS) fprintf(stderr, "[Bench] Lost items: %zu\n", drained);
+
+    fluxion_ingest_destroy(queue);
+    fluxion_cleanup(&ctx);
+    free(threads);
+    free(args);
+    return elapsed;
+}
+
+/* ============================================================================
+ * MUTEX BASELINE
+ * ============================================================================
+ */
+
+static void* bench_mutex_producer(void* arg) {
+    BenchProducer* p = arg;
+    size_t share = bench_share(p);
+
+    for (size_t i = 0; i < share; i++) {
+        Node* target = &sources[(p->index + i) % BENCH_TARGETS];
+        pthread_mutex_lock(p->lock);
+        fluxion_emit(p->ctx, target, (void*)&payload);
+        fluxion_pulse(p->ctx, NULL, 0);
+        pthread_mutex_unlock(p->lock);
+    }
+    return NULL;
+}
+
+static double bench_mutex(unsigned producers) {
+    FluxionContext ctx = fluxion_init();
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_t* threads = malloc(sizeof(pthread_t) * producers);
+    BenchProducer* args = malloc(sizeof(BenchProducer) * producers);
+    if (!threads || !args) exit(1);
+
+    double start = bench_now();
+
+    for (unsigned i = 0; i < producers; i++) {
+        args[i] = (BenchProducer){ i, producers, NULL, &ctx, &lock };
+        pthread_create(&threads[i], NULL, bench_mutex_producer, &args[i]);
+    }
+    for (unsigned i = 0; i < producers; i++) pthread_join(threads[i], NULL);
+
+    double elapsed = bench_now() - start;
+
+    fluxion_cleanup(&ctx);
+    free(threads);
+    free(args);
+    return elapsed;
+}
+
+int main(void) {
+    for (size_t i = 0; i < BENCH_TARGETS; i++) {
+        NODE_INIT(sources[i], Source, "uint32_t");
+        NODE_INIT(sinks[i], Sink, "uint32_t");
+        fluxion_link(&sources[i], &sinks[i]);
+    }
+
+    for (unsigned producers = 1; producers <= 32; producers *= 2) {
+        bench_sum = 0;
+        bench_report("queue", producers, bench_queue(producers));
+        if (bench_sum != BENCH_ITEMS) fprintf(stderr, "[Bench] Unexpected sum\n");
+
+        bench_sum = 0;
+        bench_report("mutex", producers, bench_mutex(producers));
+        if (bench_sum != BENCH_ITEMS) fprintf(stderr, "[Bench] Unexpected sum\n");
+    }
+
+    for (size_t i = 0; i < BENCH_TARGETS; i++) {
+        fluxion_node_cleanup(&sources[i]);
+        fluxion_node_cleanup(&sinks[i]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,203 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_runtime.h"
+#include "../include/fluxion_node.h"
+#include "../include/fluxion_ingest.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* ============================================================================
+ * FLUXION — OVERLOAD BENCHMARK
+ *
+ * A producer thread offers BENCH_ITEMS emissions at BENCH_OVERDRIVE
+ * times the rate a 5-stage chain can pulse them, in bursts every
+ * millisecond. One item in four has a high priority. Latency runs from
+ * the item's scheduled emission time (not the push) to the sink, so a
+ * blocked producer shows up in the tail. Reported for each shedding
+ * policy: delivered items, drop rate and latency percentiles.
+ * ============================================================================
+ */
+
+#define BENCH_ITEMS      100000
+#define BENCH_STAGES     4
+#define BENCH_WORK_NS    2000
+#define BENCH_OVERDRIVE  2.0
+#define BENCH_TICK_NS    1000000
+#define BENCH_CAPACITY   4096
+#define BENCH_WATERMARK  256
+
+typedef struct {
+    uint64_t scheduled;
+    unsigned priority;
+} BenchItem;
+
+static BenchItem items[BENCH_ITEMS];
+static uint64_t latencies[BENCH_ITEMS];
+static size_t delivered = 0;
+static size_t delivered_high = 0;
+
+static void bench_work(void) {
+    uint64_t end = fluxion_time_ns() + BENCH_WORK_NS;
+    while (fluxion_time_ns() < end) {}
+}
+
+FLUX_NODE(Source) {
+    (void)self;
+    (void)data;
+}
+
+FLUX_NODE(Stage) {
+    (void)self;
+    (void)data;
+    bench_work();
+}
+
+FLUX_NODE(Sink) {
+    (void)self;
+    const BenchItem* item = data;
+    latencies[delivered++] = fluxion_time_ns() - item->scheduled;
+    if (item->priority) delivered_high++;
+}
+
+static Node source;
+static Node stages[BENCH_STAGES];
+static Node sink;
+
+typedef struct {
+    FluxionIngest* queue;
+    uint64_t interval_ns;     // Between two scheduled items
+    int blocking;             // No shedding: wait for room
+} BenchProducer;
+
+static void* bench_producer(void* arg) {
+    BenchProducer* p = arg;
+    uint64_t start = fluxion_time_ns();
+    size_t next = 0;
+
+    while (next < BENCH_ITEMS) {
+        /* Every item whose time has come is offered at once */
+        uint64_t now = fluxion_time_ns();
+        while (next < BENCH_ITEMS && start + next * p->interval_ns <= now) {
+            items[next].scheduled = start + next * p->interval_ns;
+            items[next].priority  = (next % 4 == 0) ? 1 : 0;
+            if (p->blocking) {
+                fluxion_ingest_push(p->queue, &source, &items[next]);
+            } else {
+                fluxion_ingest_push_priority(p->queue, &source, &items[next], items[next].priority);
+            }
+            next++;
+        }
+
+        struct timespec tick = { 0, BENCH_TICK_NS };
+        nanosleep(&tick, NULL);
+    }
+
+    fluxion_ingest_close(p->queue);
+    return NULL;
+}
+
+static int bench_compare(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a;
+    uint64_t y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+static double bench_percentile(double p) {
+    if (delivered == 0) return 0.0;
+    size_t rank = (size_t)(p * (double)(delivered - 1));
+    return (double)latencies[rank] / 1000.0;
+}
+
+/**
+ * @brief Service time of one item through the chain, without a queue
+ */
+static uint64_t bench_calibrate(void) {
+    FluxionContext ctx = fluxion_init();
+    BenchItem item = { 0, 0 };
+    const size_t rounds = 2000;
+
+    uint64_t start = fluxion_time_ns();
+    for (size_t i = 0; i < rounds; i++) {
+        item.scheduled = fluxion_time_ns();
+        fluxion_emit(&ctx, &source, &item);
+        fluxion_pulse(&ctx, NULL, 0);
+    }
+    uint64_t elapsed = fluxion_time_ns() - start;
+
+    fluxion_cleanup(&ctx);
+    delivered = 0;
+    delivered_high = 0;
+    return elapsed / rounds;
+}
+
+static void bench_policy(const char* label, FluxionShedPolicy shed, uint64_t interval_ns) {
+    FluxionContext ctx = fluxion_init();
+    FluxionIngestConfig config = fluxion_ingest_default_config();
+    config.capacity       = BENCH_CAPACITY;
+    config.shed           = shed;
+    config.shed_watermark = BENCH_WATERMARK;
+    config.shed_priority  = 1;
+    config.sample_every   = 4;
+
+    FluxionIngest* queue = fluxion_ingest_create(&config);
+    if (!queue) exit(1);
+
+    delivered = 0;
+    delivered_high = 0;
+
+    BenchProducer producer = { queue, interval_ns, shed == FLUXION_SHED_NONE };
+    pthread_t thread;
+    uint64_t start = fluxion_time_ns();
+    pthread_create(&thread, NULL, bench_producer, &producer);
+
+    fluxion_ingest_run(&ctx, queue);
+    pthread_join(thread, NULL);
+    double elapsed = (double)(fluxion_time_ns() - start) * 1e-9;
+
+    qsort(latencies, delivered, sizeof(uint64_t), bench_compare);
+
+    size_t high = (BENCH_ITEMS + 3) / 4;
+    printf("%-12s delivered=%-6zu drop=%5.1f%% high-drop=%5.1f%% items/sec=%.3e "
+           "p50=%9.1fus p99=%9.1fus p999=%9.1fus\n",
+           label, delivered,
+           100.0 * (double)(BENCH_ITEMS - delivered) / BENCH_ITEMS,
+           100.0 * (double)(high - delivered_high) / (double)high,
+           (double)delivered / elapsed,
+           bench_percentile(0.50), bench_percentile(0.99), bench_percentile(0.999));
+
+    fluxion_ingest_destroy(queue);
+    fluxion_cleanup(&ctx);
+}
+
+int main(void) {
+    NODE_INIT(source, Source, "BenchItem");
+    NODE_INIT(sink, Sink, "BenchItem");
+
+    Node* prev = &source;
+    for (size_t i = 0; i < BENCH_STAGES; i++) {
+        NODE_INIT(stages[i], Stage, "BenchItem");
+        fluxion_link(prev, &stages[i]);
+        prev = &stages[i];
+    }
+    fluxion_link(prev, &sink);
+
+    uint64_t service_ns = bench_calibrate();
+    uint64_t interval_ns = (uint64_t)((double)service_ns / BENCH_OVERDRIVE);
+    if (interval_ns == 0) interval_ns = 1;
+
+    printf("service=%lluns/item offered=%.3e items/sec (x%.1f) watermark=%d\n",
+           (unsigned long long)service_ns, 1e9 / (double)interval_ns, BENCH_OVERDRIVE, BENCH_WATERMARK);
+
+    bench_policy("none", FLUXION_SHED_NONE, interval_ns);
+    bench_policy("drop-newest", FLUXION_SHED_DROP_NEWEST, interval_ns);
+    bench_policy("drop-oldest", FLUXION_SHED_DROP_OLDEST, interval_ns);
+    bench_policy("priority", FLUXION_SHED_PRIORITY, interval_ns);
+    bench_policy("sample-1/4", FLUXION_SHED_SAMPLE, interval_ns);
+
+    fluxion_node_cleanup(&source);
+    for (size_t i = 0; i < BENCH_STAGES; i++) fluxion_node_cleanup(&stages[i]);
+    fluxion_node_cleanup(&sink);
+    return 0;
+}
@@ -0,0 +1,156 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_runtime.h"
+#include "../include/fluxion_node.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* ============================================================================
+ * FLUXION — PARALLEL EXECUTION BENCHMARK
+ *
+ * Runs a layered DAG under FLUXION_EXEC_PARALLEL, once with
+ * fluxion_set_deterministic() (levels run serially on the caller) and
+ * once on the worker pool, and reports both pulse rates. Every node
+ * rewrites the emitted message (fluxion_msg_write()), so same-level
+ * parents race to hand their copy to a shared child. The per-node run
+ * counts and inputs of both runs must match: the program exits with
+ * status 1 otherwise.
+ * ============================================================================
+ */
+
+#define BENCH_WIDTH   256     // Nodes per level
+#define BENCH_LEVELS  32      // Levels under the root
+#define BENCH_ROUNDS  100
+#define BENCH_WORKERS 4
+#define BENCH_WORK    500     // Hash steps per action
+
+#define BENCH_NODES (1 + BENCH_WIDTH * BENCH_LEVELS)
+
+static Node* bench_nodes;
+
+/* Indexed by node: each node runs on one thread at a time */
+static uint64_t* bench_runs;
+static uint64_t* bench_seen;
+
+FLUX_NODE(Rewrite) {
+    size_t i = (size_t)(self - bench_nodes);
+    uint64_t* v = data;
+
+    bench_runs[i]++;
+    bench_seen[i] = bench_seen[i] * 1000003u + *v;
+
+    uint64_t x = *v ^ i;
+    for (int k = 0; k < BENCH_WORK; k++) x = x * 6364136223846793005u + 1442695040888963407u;
+
+    v = fluxion_msg_write(self, data);
+    if (v) *v = x;
+}
+
+static double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Root, then BENCH_LEVELS levels: each node has two parents one level up
+ */
+static void bench_build(void) {
+    for (size_t i = 0; i < BENCH_NODES; i++) {
+        NODE_INIT(bench_nodes[i], Rewrite, "u64");
+    }
+
+    for (size_t j = 0; j < BENCH_WIDTH; j++) fluxion_link(&bench_nodes[0], &bench_nodes[1 + j]);
+
+    for (size_t l = 1; l < BENCH_LEVELS; l++) {
+        Node* up   = &bench_nodes[1 + (l - 1) * BENCH_WIDTH];
+        Node* down = &bench_nodes[1 + l * BENCH_WIDTH];
+
+        for (size_t j = 0; j < BENCH_WIDTH; j++) {
+            size_t a = j;
+            size_t b = (j * 7 + 3) % BENCH_WIDTH;
+            if (b == a) b = (a + 1) % BENCH_WIDTH;
+
+            fluxion_link(&up[a], &down[j]);
+            fluxion_link(&up[b], &down[j]);
+        }
+    }
+}
+
+/**
+ * @brief BENCH_ROUNDS emit + pulse rounds, recording runs and inputs
+ * @return Pulses per second, 0 if the run could not be set up
+ */
+static double bench_run(int deterministic, uint64_t* runs, uint64_t* seen) {
+    memset(runs, 0, sizeof(uint64_t) * BENCH_NODES);
+    memset(seen, 0, sizeof(uint64_t) * BENCH_NODES);
+    bench_runs = runs;
+    bench_seen = seen;
+
+    FluxionContext ctx = fluxion_init();
+    fluxion_set_policy(&ctx, FLUXION_EXEC_PARALLEL);
+    fluxion_set_deterministic(&ctx, deterministic);
+    if (fluxion_set_workers(&ctx, BENCH_WORKERS) != FLUXION_OK) {
+        fluxion_cleanup(&ctx);
+        return 0.0;
+    }
+
+    double t0 = bench_now();
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        uint64_t* msg = fluxion_msg_alloc(&ctx, sizeof(uint64_t));
+        if (!msg) break;
+        *msg = (uint64_t)r;
+
+        fluxion_emit(&ctx, &bench_nodes[0], msg);
+        fluxion_pulse(&ctx, NULL, 0);
+    }
+    double elapsed = bench_now() - t0;
+
+    printf("%-14s workers=%d nodes=%d pulses/sec=%.1f ns/node=%.1f\n",
+           deterministic ? "deterministic" : "parallel", BENCH_WORKERS, BENCH_NODES,
+           BENCH_ROUNDS / elapsed, elapsed * 1e9 / ((double)BENCH_ROUNDS * BENCH_NODES));
+
+    fluxion_cleanup(&ctx);
+    return BENCH_ROUNDS / elapsed;
+}
+
+int main(void) {
+    if (posix_memalign((void**)&bench_nodes, FLUXION_NODE_ALIGN, sizeof(Node) * BENCH_NODES) != 0) return 1;
+    memset(bench_nodes, 0, sizeof(Node) * BENCH_NODES);
+    uint64_t* expected_runs = malloc(sizeof(uint64_t) * BENCH_NODES);
+    uint64_t* expected_seen = malloc(sizeof(uint64_t) * BENCH_NODES);
+    uint64_t* runs = malloc(sizeof(uint64_t) * BENCH_NODES);
+    uint64_t* seen = malloc(sizeof(uint64_t) * BENCH_NODES);
+    if (!bench_nodes || !expected_runs || !expected_seen || !runs || !seen) return 1;
+
+    bench_build();
+
+    double serial = bench_run(1, expected_runs, expected_seen);
+    double parallel = bench_run(0, runs, seen);
+    if (serial <= 0.0 || parallel <= 0.0) return 1;
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < BENCH_NODES; i++) {
+        if (expected_runs[i] != BENCH_ROUNDS) mismatches++;
+        if (runs[i] == expected_runs[i] && seen[i] == expected_seen[i]) continue;
+
+        if (mismatches++ < 5) {
+            fprintf(stderr, "node %zu: runs %llu/%llu, input hash %016llx/%016llx\n", i,
+                    (unsigned long long)runs[i], (unsigned long long)expected_runs[i],
+                    (unsigned long long)seen[i], (unsigned long long)expected_seen[i]);
+        }
+    }
+
+    printf("speedup=%.2fx check=%s\n", parallel / serial, mismatches ? "FAILED" : "ok");
+
+    for (size_t i = 0; i < BENCH_NODES; i++) fluxion_node_cleanup(&bench_nodes[i]);
+    free(bench_nodes);
+    free(expected_runs);
+    free(expected_seen);
+    free(runs);
+    free(seen);
+
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,118 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_runtime.h"
+#include "../include/fluxion_node.h"
+#include "../include/fluxion_sched.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* ============================================================================
+ * FLUXION — PRIORITY ORDERING BENCHMARK
+ *
+ * One source feeds three branches, subscribed in this order:
+ * - logging:     BENCH_MAX_LOGGERS bulk nodes (only `width` are linked)
+ * - aggregation: a chain of normal nodes
+ * - alerting:    a normal pre-filter, then a critical alert node
+ *                with a BENCH_DEADLINE_NS deadline
+ * Every node busy-waits BENCH_WORK_NS. The topological queue runs the
+ * alert after the whole logging branch; the priority and deadline
+ * orderings run it first, whatever the logging width.
+ * ============================================================================
+ */
+
+#define BENCH_PULSES       2000
+#define BENCH_MAX_LOGGERS  256
+#define BENCH_AGGREGATORS  8
+#define BENCH_WORK_NS      1000
+#define BENCH_DEADLINE_NS  20000
+
+static void bench_work(void) {
+    uint64_t end = fluxion_time_ns() + BENCH_WORK_NS;
+    while (fluxion_time_ns() < end) {}
+}
+
+FLUX_NODE(Work) {
+    (void)self;
+    (void)data;
+    bench_work();
+}
+
+FLUX_NODE(Source) {
+    (void)self;
+    (void)data;
+}
+
+static Node source;
+static Node loggers[BENCH_MAX_LOGGERS];
+static Node aggregators[BENCH_AGGREGATORS];
+static Node prefilter;
+static Node alert;
+
+static void bench_build(size_t width) {
+    NODE_INIT(source, Source, "int");
+
+    for (size_t i = 0; i < width; i++) {
+        NODE_INIT(loggers[i], Work, "int");
+        fluxion_node_set_priority(&loggers[i], FLUXION_PRIORITY_BULK, 0);
+        fluxion_link(&source, &loggers[i]);
+    }
+
+    Node* prev = &source;
+    for (size_t i = 0; i < BENCH_AGGREGATORS; i++) {
+        NODE_INIT(aggregators[i], Work, "int");
+        fluxion_link(prev, &aggregators[i]);
+        prev = &aggregators[i];
+    }
+
+    NODE_INIT(prefilter, Work, "int");
+    NODE_INIT(alert, Work, "int");
+    fluxion_node_set_priority(&alert, FLUXION_PRIORITY_CRITICAL, BENCH_DEADLINE_NS);
+    fluxion_link(&source, &prefilter);
+    fluxion_link(&prefilter, &alert);
+}
+
+static void bench_teardown(size_t width) {
+    fluxion_node_cleanup(&source);
+    for (size_t i = 0; i < width; i++) fluxion_node_cleanup(&loggers[i]);
+    for (size_t i = 0; i < BENCH_AGGREGATORS; i++) fluxion_node_cleanup(&aggregators[i]);
+    fluxion_node_cleanup(&prefilter);
+    fluxion_node_cleanup(&alert);
+}
+
+static void bench_run(const char* label, FluxionOrdering ordering, size_t width) {
+    FluxionContext ctx = fluxion_init();
+    fluxion_set_ordering(&ctx, ordering);
+    if (fluxion_enable_class_stats(&ctx, 1) != FLUXION_OK) exit(1);
+
+    int value = 1;
+    uint64_t start = fluxion_time_ns();
+    for (int i = 0; i < BENCH_PULSES; i++) {
+        fluxion_emit(&ctx, &source, &value);
+        fluxion_pulse(&ctx, NULL, 0);
+    }
+    double elapsed = (double)(fluxion_time_ns() - start);
+
+    FluxionClassStats critical = fluxion_class_stats(&ctx, FLUXION_PRIORITY_CRITICAL);
+    FluxionClassStats bulk = fluxion_class_stats(&ctx, FLUXION_PRIORITY_BULK);
+
+    printf("%-11s loggers=%-3zu alert p50=%7.1fus p99=%7.1fus misses=%-5llu bulk p99=%7.1fus pulse=%7.1fus\n",
+           label, width,
+           fluxion_class_percentile(&critical, 0.50) / 1000.0,
+           fluxion_class_percentile(&critical, 0.99) / 1000.0,
+           (unsigned long long)critical.deadline_misses,
+           fluxion_class_percentile(&bulk, 0.99) / 1000.0,
+           elapsed / BENCH_PULSES / 1000.0);
+
+    fluxion_cleanup(&ctx);
+}
+
+int main(void) {
+    for (size_t width = 16; width <= BENCH_MAX_LOGGERS; width *= 4) {
+        bench_build(width);
+        bench_run("topological", FLUXION_ORDER_TOPOLOGICAL, width);
+        bench_run("priority", FLUXION_ORDER_PRIORITY, width);
+        bench_run("deadline", FLUXION_ORDER_DEADLINE, width);
+        bench_teardown(width);
+    }
+    return 0;
+}
@@ -0,0 +1,154 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_runtime.h"
+#include "../include/fluxion_node.h"
+#include "../include/fluxion_plan.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* ============================================================================
+ * FLUXION — PROPAGATION BENCHMARK
+ *
+ * Measures emit-time propagation throughput (edges/sec) on
+ * 100k-node chains and fan-outs, with and without a compiled plan,
+ * and the pulse cost of sparse activations under both schedulers.
+ * ============================================================================
+ */
+
+#define BENCH_NODES  100000
+#define BENCH_ROUNDS 50
+
+FLUX_NODE(Noop) {
+    (void)self;
+    (void)data;
+}
+
+static double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static Node* bench_make_nodes(size_t count) {
+    Node* nodes = NULL;
+    if (posix_memalign((void**)&nodes, FLUXION_NODE_ALIGN, sizeof(Node) * count) != 0) return NULL;
+    for (size_t i = 0; i < count; i++) {
+        NODE_INIT(nodes[i], Noop, "int");
+    }
+    return nodes;
+}
+
+static void bench_free_nodes(Node* nodes, size_t count) {
+    for (size_t i = 0; i < count; i++) fluxion_node_cleanup(&nodes[i]);
+    free(nodes);
+}
+
+/**
+ * @brief Times BENCH_ROUNDS emissions into nodes[0]
+ *
+ * Pulses run outside the timed region, so only propagation is measured.
+ */
+static void bench_run(const char* label, Node* nodes, size_t count, size_t edges, int planned) {
+    Node** graph = malloc(sizeof(Node*) * count);
+    if (!graph) return;
+    for (size_t i = 0; i < count; i++) graph[i] = &nodes[i];
+
+    FluxionContext ctx = fluxion_init();
+    FluxionPlan* plan = NULL;
+
+    if (planned) {
+        plan = fluxion_plan_compile(graph, count);
+        if (!plan) {
+            free(graph);
+            return;
+        }
+        fluxion_set_plan(&ctx, plan);
+    }
+
+    int value = 1;
+    double elapsed = 0.0;
+
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        double t0 = bench_now();
+        fluxion_emit(&ctx, &nodes[0], &value);
+        elapsed += bench_now() - t0;
+
+        if (plan) fluxion_pulse_plan(&ctx, plan);
+        else fluxion_pulse(&ctx, graph, count);
+    }
+
+    double total_edges = (double)edges * BENCH_ROUNDS;
+    printf("%-22s %-6s nodes=%zu edges/sec=%.3e ns/edge=%.2f\n",
+           label, planned ? "plan" : "ptr", count,
+           total_edges / elapsed, elapsed * 1e9 / total_edges);
+
+    fluxion_cleanup(&ctx);
+    fluxion_plan_destroy(plan);
+    free(graph);
+}
+
+/**
+ * @brief Sparse workload: each emit activates 3 nodes out of `count`
+ */
+static void bench_sparse(Node* nodes, size_t count, FluxionScheduling scheduling) {
+    Node** graph = malloc(sizeof(Node*) * count);
+    if (!graph) return;
+    for (size_t i = 0; i < count; i++) graph[i] = &nodes[i];
+
+    FluxionContext ctx = fluxion_init();
+    fluxion_set_scheduling(&ctx, scheduling);
+
+    int value = 1;
+    double elapsed = 0.0;
+
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        fluxion_emit(&ctx, &nodes[(size_t)r * 3 % count], &value);
+
+        double t0 = bench_now();
+        fluxion_pulse(&ctx, graph, count);
+        elapsed += bench_now() - t0;
+    }
+
+    printf("%-22s %-6s nodes=%zu ns/pulse=%.0f\n",
+           "sparse_pulse",
+           scheduling == FLUXION_SCHED_READY_QUEUE ? "queue" : "scan",
+           count, elapsed * 1e9 / BENCH_ROUNDS);
+
+    fluxion_cleanup(&ctx);
+    free(graph);
+}
+
+int main(void) {
+    /* --- Chain: n0 -> n1 -> ... -> nN-1 --- */
+    Node* chain = bench_make_nodes(BENCH_NODES);
+    if (!chain) return 1;
+    for (size_t i = 0; i + 1 < BENCH_NODES; i++) fluxion_link(&chain[i], &chain[i + 1]);
+
+    bench_run("chain", chain, BENCH_NODES, BENCH_NODES - 1, 0);
+    bench_run("chain", chain, BENCH_NODES, BENCH_NODES - 1, 1);
+    bench_free_nodes(chain, BENCH_NODES);
+
+    /* --- Fan-out: n0 -> {n1 .. nN-1} --- */
+    Node* fan = bench_make_nodes(BENCH_NODES);
+    if (!fan) return 1;
+    for (size_t i = 1; i < BENCH_NODES; i++) fluxion_link(&fan[0], &fan[i]);
+
+    bench_run("fanout", fan, BENCH_NODES, BENCH_NODES - 1, 0);
+    bench_run("fanout", fan, BENCH_NODES, BENCH_NODES - 1, 1);
+    bench_free_nodes(fan, BENCH_NODES);
+
+    /* --- Sparse: independent 3-node chains, one activated per pulse --- */
+    Node* sparse = bench_make_nodes(BENCH_NODES);
+    if (!sparse) return 1;
+    for (size_t i = 0; i + 2 < BENCH_NODES; i += 3) {
+        fluxion_link(&sparse[i], &sparse[i + 1]);
+        fluxion_link(&sparse[i + 1], &sparse[i + 2]);
+    }
+
+    bench_sparse(sparse, BENCH_NODES, FLUXION_SCHED_FULL_SCAN);
+    bench_sparse(sparse, BENCH_NODES, FLUXION_SCHED_READY_QUEUE);
+    bench_free_nodes(sparse, BENCH_NODES);
+
+    return 0;
+}
@@ -0,0 +1,436 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_runtime.h"
+#include "../include/fluxion_node.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* ============================================================================
+ * FLUXION — BENCHMARK SUITE
+ *
+ * Usage: bench_suite [results.json] [nodes]
+ *
+ * Generates synthetic graphs (chain, fan-out, diamonds, random DAG,
+ * layered DAG) and measures fluxion_link(), fluxion_emit() and
+ * fluxion_pulse() on each: operations/sec, edges/sec, ns per node and
+ * allocations per operation. Results are printed as a table and written
+ * as JSON (default bench_results.json), so runs can be compared across
+ * versions.
+ *
+ * Allocations are counted when built with -DBENCH_COUNT_ALLOCS and the
+ * linker wraps (GNU ld):
+ *   -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=posix_memalign
+ * Otherwise they are reported as null.
+ * ============================================================================
+ */
+
+#define BENCH_DEFAULT_NODES 10000
+#define BENCH_NODE_VISITS   4000000  // Nodes executed per pulse scenario
+#define BENCH_MIN_ROUNDS    20
+#define BENCH_SEED          42
+
+FLUX_NODE(Noop) {
+    (void)self;
+    (void)data;
+}
+
+/* ============================================================================
+ * ALLOCATION COUNTER
+ * ============================================================================
+ */
+
+#ifdef BENCH_COUNT_ALLOCS
+static unsigned long long bench_allocs;
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+int __real_posix_memalign(void** ptr, size_t align, size_t size);
+
+void* __wrap_malloc(size_t size) {
+    __atomic_add_fetch(&bench_allocs, 1, __ATOMIC_RELAXED);
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    __atomic_add_fetch(&bench_allocs, 1, __ATOMIC_RELAXED);
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    __atomic_add_fetch(&bench_allocs, 1, __ATOMIC_RELAXED);
+    return __real_realloc(ptr, size);
+}
+
+int __wrap_posix_memalign(void** ptr, size_t align, size_t size) {
+    __atomic_add_fetch(&bench_allocs, 1, __ATOMIC_RELAXED);
+    return __real_posix_memalign(ptr, align, size);
+}
+
+#define BENCH_ALLOCS_COUNTED 1
+static unsigned long long bench_alloc_count(void) {
+    return __atomic_load_n(&bench_allocs, __ATOMIC_RELAXED);
+}
+#else
+#define BENCH_ALLOCS_COUNTED 0
+static unsigned long long bench_alloc_count(void) {
+    return 0;
+}
+#endif
+
+/* ============================================================================
+ * GRAPH GENERATORS
+ *
+ * A generator fills an edge list over nodes 0..n-1. Edges go from lower
+ * to higher indices (the graphs are DAGs) and node 0 reaches every node,
+ * so one emission into node 0 activates the whole graph. Repeated edges
+ * are dropped after generation (see bench_dedupe()).
+ * ============================================================================
+ */
+
+typedef struct {
+    unsigned* from;
+    unsigned* to;
+    size_t count;
+    size_t capacity;
+} BenchEdges;
+
+static int bench_edge(BenchEdges* e, size_t from, size_t to) {
+    if (e->count == e->capacity) {
+        size_t grown = e->capacity ? e->capacity * 2 : 1024;
+        unsigned* f = realloc(e->from, grown * sizeof(unsigned));
+        if (!f) return 0;
+        e->from = f;
+        unsigned* t = realloc(e->to, grown * sizeof(unsigned));
+        if (!t) return 0;
+        e->to = t;
+        e->capacity = grown;
+    }
+    e->from[e->count] = (unsigned)from;
+    e->to[e->count]   = (unsigned)to;
+    e->count++;
+    return 1;
+}
+
+static const BenchEdges* bench_sorting;
+
+static int bench_edge_compare(const void* a, const void* b) {
+    size_t i = *(const size_t*)a, j = *(const size_t*)b;
+    const BenchEdges* e = bench_sorting;
+
+    if (e->from[i] != e->from[j]) return e->from[i] < e->from[j] ? -1 : 1;
+    if (e->to[i] != e->to[j]) return e->to[i] < e->to[j] ? -1 : 1;
+    return i < j ? -1 : (i > j);
+}
+
+/**
+ * @brief Drops repeated edges, keeping the first of each in list order
+ *
+ * fluxion_link() does not refuse parallel edges: without this pass they
+ * would be linked, traversed and counted as distinct edges.
+ */
+static int bench_dedupe(BenchEdges* e) {
+    if (e->count < 2) return 1;
+
+    size_t* order = malloc(e->count * sizeof(size_t));
+    unsigned char* repeated = calloc(e->count, 1);
+    if (!order || !repeated) {
+        free(order);
+        free(repeated);
+        return 0;
+    }
+
+    for (size_t i = 0; i < e->count; i++) order[i] = i;
+    bench_sorting = e;
+    qsort(order, e->count, sizeof(size_t), bench_edge_compare);
+
+    for (size_t i = 1; i < e->count; i++) {
+        size_t prev = order[i - 1], cur = order[i];
+        if (e->from[prev] == e->from[cur] && e->to[prev] == e->to[cur]) repeated[cur] = 1;
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < e->count; i++) {
+        if (repeated[i]) continue;
+        e->from[kept] = e->from[i];
+        e->to[kept]   = e->to[i];
+        kept++;
+    }
+    e->count = kept;
+
+    free(order);
+    free(repeated);
+    return 1;
+}
+
+/* Deterministic generator: the same graphs on every run */
+static unsigned long long bench_rng = BENCH_SEED;
+
+static size_t bench_random(size_t bound) {
+    bench_rng = bench_rng * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (size_t)((bench_rng >> 33) % bound);
+}
+
+/* n0 -> n1 -> ... -> nN-1 */
+static int bench_gen_chain(BenchEdges* e, size_t n) {
+    for (size_t i = 0; i + 1 < n; i++) {
+        if (!bench_edge(e, i, i + 1)) return 0;
+    }
+    return 1;
+}
+
+/* n0 -> {n1 .. nN-1} */
+static int bench_gen_fanout(BenchEdges* e, size_t n) {
+    for (size_t i = 1; i < n; i++) {
+        if (!bench_edge(e, 0, i)) return 0;
+    }
+    return 1;
+}
+
+/* Chained diamonds: top -> {left, right} -> bottom, bottom = next top */
+static int bench_gen_diamond(BenchEdges* e, size_t n) {
+    for (size_t top = 0; top + 3 < n; top += 3) {
+        if (!bench_edge(e, top, top + 1) || !bench_edge(e, top, top + 2) ||
+            !bench_edge(e, top + 1, top + 3) || !bench_edge(e, top + 2, top + 3)) return 0;
+    }
+    return 1;
+}
+
+/* Each node has a random predecessor, plus two more edges on average */
+static int bench_gen_random(BenchEdges* e, size_t n) {
+    for (size_t j = 1; j < n; j++) {
+        if (!bench_edge(e, bench_random(j), j)) return 0;
+    }
+    for (size_t k = 0; k < 2 * n; k++) {
+        size_t a = bench_random(n);
+        size_t b = bench_random(n);
+        if (a == b) continue;
+        if (!bench_edge(e, a < b ? a : b, a < b ? b : a)) return 0;
+    }
+    return 1;
+}
+
+/* A root, then layers of 64 nodes with 3 predecessors in the previous layer */
+static int bench_gen_layered(BenchEdges* e, size_t n) {
+    const size_t width = 64;
+
+    for (size_t j = 1; j < n; j++) {
+        size_t layer = (j - 1) / width;
+        if (layer == 0) {
+            if (!bench_edge(e, 0, j)) return 0;
+            continue;
+        }
+
+        size_t prev = 1 + (layer - 1) * width;
+        for (int k = 0; k < 3; k++) {
+            if (!bench_edge(e, prev + bench_random(width), j)) return 0;
+        }
+    }
+    return 1;
+}
+
+typedef struct {
+    const char* name;
+    int (*generate)(BenchEdges* e, size_t n);
+} BenchGraph;
+
+static const BenchGraph bench_graphs[] = {
+    { "chain",   bench_gen_chain },
+    { "fanout",  bench_gen_fanout },
+    { "diamond", bench_gen_diamond },
+    { "random",  bench_gen_random },
+    { "layered", bench_gen_layered },
+};
+
+/* ============================================================================
+ * MEASUREMENT
+ * ============================================================================
+ */
+
+typedef struct {
+    const char* graph;
+    const char* op;               // "link", "emit" or "pulse"
+    size_t nodes;
+    size_t edges;
+    unsigned long long ops;       // Timed calls
+    double ns_per_op;
+    double ops_per_sec;
+    double edges_per_sec;         // Edges linked or traversed per second
+    double ns_per_node;           // Per edge linked, node activated or node executed
+    double allocs_per_op;
+} BenchResult;
+
+static void bench_print(const BenchResult* r) {
+    printf("%-8s %-6s nodes=%-6zu edges=%-6zu %12.0f ops/s %12.3e edges/s %8.2f ns/node",
+           r->graph, r->op, r->nodes, r->edges, r->ops_per_sec, r->edges_per_sec, r->ns_per_node);
+    if (BENCH_ALLOCS_COUNTED) printf(" %8.2f allocs/op", r->allocs_per_op);
+    printf("\n");
+}
+
+static void bench_result(BenchResult* r, const char* graph, const char* op, size_t nodes, size_t edges,
+                         unsigned long long ops, uint64_t ns, unsigned long long allocs,
+                         double edges_per_op, double nodes_per_op) {
+    double seconds = ns > 0 ? (double)ns * 1e-9 : 1e-9;
+
+    r->graph         = graph;
+    r->op            = op;
+    r->nodes         = nodes;
+    r->edges         = edges;
+    r->ops           = ops;
+    r->ns_per_op     = (double)ns / (double)ops;
+    r->ops_per_sec   = (double)ops / seconds;
+    r->edges_per_sec = edges_per_op * (double)ops / seconds;
+    r->ns_per_node   = nodes_per_op > 0 ? r->ns_per_op / nodes_per_op : 0.0;
+    r->allocs_per_op = (double)allocs / (double)ops;
+    bench_print(r);
+}
+
+/**
+ * @brief Links, emits into and pulses one generated graph
+ * @param out Receives the three results (link, emit, pulse)
+ * @return 0 on allocation failure
+ */
+static int bench_graph(const BenchGraph* g, size_t n, BenchResult out[3]) {
+    BenchEdges e = { NULL, NULL, 0, 0 };
+    Node* nodes = NULL;
+    if (posix_memalign((void**)&nodes, FLUXION_NODE_ALIGN, sizeof(Node) * n) != 0) nodes = NULL;
+    else memset(nodes, 0, sizeof(Node) * n);
+    Node** graph = malloc(sizeof(Node*) * n);
+    if (!nodes || !graph || !g->generate(&e, n) || !bench_dedupe(&e)) {
+        free(e.from);
+        free(e.to);
+        free(graph);
+        free(nodes);
+        return 0;
+    }
+    for (size_t i = 0; i < n; i++) {
+        NODE_INIT(nodes[i], Noop, "int");
+        graph[i] = &nodes[i];
+    }
+
+    /* --- fluxion_link(): the whole edge list --- */
+    unsigned long long a0 = bench_alloc_count();
+    uint64_t t0 = fluxion_time_ns();
+    for (size_t i = 0; i < e.count; i++) fluxion_link(&nodes[e.from[i]], &nodes[e.to[i]]);
+    uint64_t link_ns = fluxion_time_ns() - t0;
+    unsigned long long link_allocs = bench_alloc_count() - a0;
+
+    /* Edges are distinct: each link adds one */
+    size_t edges = e.count;
+
+    bench_result(&out[0], g->name, "link", n, edges, e.count, link_ns, link_allocs, 1.0, 1.0);
+
+    /* --- fluxion_emit() then fluxion_pulse(), timed apart --- */
+    FluxionContext ctx = fluxion_init();
+    int value = 1;
+
+    /* Warm-up: worklist, ready queue and arena reach their steady size */
+    fluxion_emit(&ctx, &nodes[0], &value);
+    fluxion_pulse(&ctx, graph, n);
+
+    unsigned long long rounds = BENCH_NODE_VISITS / n;
+    if (rounds < BENCH_MIN_ROUNDS) rounds = BENCH_MIN_ROUNDS;
+
+    uint64_t emit_ns = 0, pulse_ns = 0;
+    unsigned long long emit_allocs = 0, pulse_allocs = 0;
+    unsigned long long activated = 0, executed = 0;
+
+    for (unsigned long long r = 0; r < rounds; r++) {
+        unsigned long long a = bench_alloc_count();
+        uint64_t t = fluxion_time_ns();
+        fluxion_emit(&ctx, &nodes[0], &value);
+        uint64_t t1 = fluxion_time_ns();
+        unsigned long long a1 = bench_alloc_count();
+        fluxion_pulse(&ctx, graph, n);
+        uint64_t t2 = fluxion_time_ns();
+
+        emit_ns      += t1 - t;
+        pulse_ns     += t2 - t1;
+        emit_allocs  += a1 - a;
+        pulse_allocs += bench_alloc_count() - a1;
+        activated    += ctx.pulse_ready;
+        executed     += ctx.pulse_executed;
+    }
+
+    /* Every edge is traversed once per emission (node 0 reaches all) */
+    bench_result(&out[1], g->name, "emit", n, edges, rounds, emit_ns, emit_allocs,
+                 (double)edges, (double)activated / (double)rounds);
+    bench_result(&out[2], g->name, "pulse", n, edges, rounds, pulse_ns, pulse_allocs,
+                 (double)edges, (double)executed / (double)rounds);
+
+    fluxion_cleanup(&ctx);
+    for (size_t i = 0; i < n; i++) fluxion_node_cleanup(&nodes[i]);
+    free(e.from);
+    free(e.to);
+    free(graph);
+    free(nodes);
+    return 1;
+}
+
+/* ============================================================================
+ * JSON OUTPUT
+ * ============================================================================
+ */
+
+static int bench_write_json(const char* path, const BenchResult* results, size_t count, size_t nodes) {
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        perror(path);
+        return 0;
+    }
+
+    fprintf(f, "{\n  \"suite\": \"fluxion\",\n  \"version\": 1,\n");
+    fprintf(f, "  \"timestamp\": %lld,\n", (long long)time(NULL));
+#ifdef __VERSION__
+    fprintf(f, "  \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+    fprintf(f, "  \"nodes\": %zu,\n  \"allocs_counted\": %s,\n  \"results\": [\n",
+            nodes, BENCH_ALLOCS_COUNTED ? "true" : "false");
+
+    for (size_t i = 0; i < count; i++) {
+        const BenchResult* r = &results[i];
+        fprintf(f, "    {\"graph\": \"%s\", \"op\": \"%s\", \"nodes\": %zu, \"edges\": %zu, "
+                   "\"ops\": %llu, \"ns_per_op\": %.3f, \"ops_per_sec\": %.3f, "
+                   "\"edges_per_sec\": %.3f, \"ns_per_node\": %.3f, \"allocs_per_op\": ",
+                r->graph, r->op, r->nodes, r->edges, r->ops, r->ns_per_op,
+                r->ops_per_sec, r->edges_per_sec, r->ns_per_node);
+        if (BENCH_ALLOCS_COUNTED) fprintf(f, "%.3f}", r->allocs_per_op);
+        else fprintf(f, "null}");
+        fprintf(f, "%s\n", i + 1 < count ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+
+    int failed = ferror(f);
+    if (fclose(f) != 0 || failed) {
+        fprintf(stderr, "%s: write failed\n", path);
+        return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char** argv) {
+    const char* path = (argc >= 2) ? argv[1] : "bench_results.json";
+    size_t nodes = (argc >= 3) ? (size_t)strtoul(argv[2], NULL, 10) : BENCH_DEFAULT_NODES;
+    if (argc > 3 || nodes < 4) {
+        fprintf(stderr, "usage: %s [results.json] [nodes >= 4]\n", argv[0]);
+        return 2;
+    }
+
+    size_t graphs = sizeof(bench_graphs) / sizeof(bench_graphs[0]);
+    BenchResult results[3 * (sizeof(bench_graphs) / sizeof(bench_graphs[0]))];
+    size_t count = 0;
+
+    for (size_t g = 0; g < graphs; g++) {
+        if (!bench_graph(&bench_graphs[g], nodes, results + count)) {
+            fprintf(stderr, "%s: out of memory\n", bench_graphs[g].name);
+            return 1;
+        }
+        count += 3;
+    }
+
+    if (!bench_write_json(path, results, count, nodes)) return 1;
+    printf("Results written to %s\n", path);
+    return 0;
+}
@@ -1,6 +1,9 @@
 #include "../include/fluxion_runtime.h"
 #include "../include/fluxion_node.h"
 #include "../include/fluxion_tools.h"
+#include "../include/fluxion_async.h"
+#include "../include/fluxion_trace.h"
+#include "../include/fluxion_shm.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
@@ -44,10 +47,13 @@ FLUX_NODE(ConfigurableMul) {
     MultiplierConfig* c = (MultiplierConfig*)self->state;
     c->activations++;
 
-    int incoming = *(int*)data;
-    *(int*)data = incoming * c->factor;
+    // Copy-on-write: the result reaches the subscribers, not the generator
+    int* value = fluxion_msg_write(self, data);
+    if (!value) return;
+
+    *value = *value * c->factor;
     printf("\033[1;33m[MUL]\033[0m x%d (Activations: %d) -> %d\n",
-           c->factor, c->activations, *(int*)data);
+           c->factor, c->activations, *value);
 }
 
 // Sliding average aggregator
@@ -63,20 +69,15 @@ FLUX_NODE(Aggregator) {
            (double)s->sum / s->count);
 }
 
-// File logger
-FLUX_NODE(FileLogger) {
-    if (!self->state) {
-        LoggerState ls = { NULL };
-        ls.file = fopen("fluxion_audit.log", "w");
-        if(ls.file) fprintf(ls.file, "--- LOG SESSION START ---\n");
-        fluxion_node_set_state(self, &ls, sizeof(LoggerState));
-    }
+// File logger: disk writes run on an I/O worker, off the pulse
+FLUX_ASYNC_NODE(FileLogger) {
     LoggerState* ls = (LoggerState*)self->state;
     if (ls && ls->file) {
         fprintf(ls->file, "[PULSE] Data: %d\n", *(int*)data);
         fflush(ls->file);
         printf("\033[1;36m[FILE]\033[0m Disk write OK\n");
     }
+    return FLUXION_NO_OUTPUT;
 }
 
 // Critical threshold monitor
@@ -96,12 +97,16 @@ int main(void) {
     fluxion_setup_terminal();
     FluxionContext ctx = fluxion_init();
 
+    // Payload layout of "int" nodes, and emit-time type checks
+    FluxionTypeId int_type = FLUXION_REGISTER_TYPE(int);
+    fluxion_set_type_checking(&ctx, 1);
+
     // Node creation
     Node gen, mul, agg, log, alert;
     NODE_INIT(gen, Generator, "int");
     NODE_INIT(mul, ConfigurableMul, "int");
     NODE_INIT(agg, Aggregator, "int");
-    NODE_INIT(log, FileLogger, "int");
+    ASYNC_NODE_INIT(log, FileLogger, "int");
     NODE_INIT(alert, SafetyThreshold, "int");
 
     // Multi-branch topology
@@ -113,21 +118,50 @@ int main(void) {
     Node* app_graph[] = { &gen, &mul, &agg, &log, &alert };
     size_t node_count = sizeof(app_graph)/sizeof(app_graph[0]);
 
+    // Freeze the topology into a compiled plan
+    FluxionPlan* plan = fluxion_plan_compile(app_graph, node_count);
+    if (!plan) return 1;
+    fluxion_set_plan(&ctx, plan);
+
+    // The logger's file is opened here: its worker never allocates state
+    LoggerState logger = { fopen("fluxion_audit.log", "w") };
+    if (logger.file) fprintf(logger.file, "--- LOG SESSION START ---\n");
+    fluxion_node_set_state(&log, &logger, sizeof(LoggerState));
+
+    // Node states are allocated from the context slab, in plan order
+    fluxion_pack_state(&ctx, plan);
+
+    // Binary pulse log, written by a background thread (tools/fluxion_log2csv)
+    fluxion_enable_logging(&ctx, "fluxion_pulses.flog");
+
+    // Per-node spans, exported below for Perfetto (ui.perfetto.dev)
+    fluxion_start_tracing(&ctx, 0);
+
+    // Per-node latency histograms, listed by the summary
+    fluxion_enable_profiling(&ctx, 1);
+
+    // Counters and node states for tools/fluxion_top, until fluxion_cleanup()
+    fluxion_publish_stats(&ctx, "fluxion_example", app_graph, node_count);
+
     printf("╔══════════════════════════════════════════════╗\n");
     printf("║   FLUXION SYSTEM : MULTI-BRANCH PIPELINE    ║\n");
     printf("╚══════════════════════════════════════════════╝\n");
 
     for (int i = 1; i <= 5; i++) {
-        int val = i * 12;
+        // Payloads live in the pulse arena and are freed when the pulse ends
+        int* val = fluxion_msg_alloc(&ctx, sizeof(int));
+        if (!val) break;
+        *val = i * 12;
         printf("\n--- Pulse %llu (Input: %d) ---\n",
-               (unsigned long long)ctx.current_pulse, val);
+               (unsigned long long)ctx.current_pulse, *val);
 
         // Inject data and execute
-        fluxion_emit(&ctx, &gen, &val);
-        fluxion_pulse(&ctx, app_graph, node_count);
+        fluxion_emit_typed(&ctx, &gen, val, int_type);
+        fluxion_pulse_plan(&ctx, plan);
 
         // Retrieve metrics and display
         FluxionMetrics m = fluxion_inspect(&ctx, app_graph, node_count);
+        fluxion_inspect_profiles(&m, app_graph, node_count);
         fluxion_trace_nodes(app_graph, node_count, &m);
 
         // Display quick summary
@@ -137,7 +171,9 @@ int main(void) {
     // Export DOT
     fluxion_export_dot(app_graph, node_count, "complex_pipeline.dot");
 
-    // Cleanup log file
+    // Deliver the pending disk writes, then close the log file
+    fluxion_async_wait(&ctx);
+    fluxion_export_trace(&ctx, "fluxion_trace.json");
     if (log.state) {
         LoggerState* ls = (LoggerState*)log.state;
         if (ls && ls->file) {
@@ -146,12 +182,14 @@ int main(void) {
         }
     }
 
-    // Cleanup nodes
+    // Cleanup nodes (their states live in the context), plan and context
     fluxion_node_cleanup(&gen);
     fluxion_node_cleanup(&mul);
     fluxion_node_cleanup(&agg);
     fluxion_node_cleanup(&log);
     fluxion_node_cleanup(&alert);
+    fluxion_plan_destroy(plan);
+    fluxion_cleanup(&ctx);
 
     printf("\n=== FLUXION CLEAN EXIT ===\n");
     printf("Press Enter to exit...");
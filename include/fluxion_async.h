@@ -0,0 +1,150 @@
+#ifndef FLUXION_ASYNC_H
+#define FLUXION_ASYNC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "fluxion_node.h"
+#include "fluxion_runtime.h"
+
+/* ============================================================================
+ * FLUXION — ASYNC NODES
+ *
+ * An async node (ASYNC_NODE_INIT) does blocking work, typically I/O,
+ * without stalling the pulse:
+ * - When the pulse reaches it, its input is submitted as a job to the
+ *   context's I/O workers, and the pulse moves on to the other nodes
+ * - Propagation stops at the node: its subscribers are not activated
+ * - The job's output is propagated to the subscribers by the first
+ *   pulse started after the job completed (see fluxion_async_poll());
+ *   a pulse delivers at most one output per node, later ones wait for
+ *   the next pulse
+ *
+ * Jobs of one node run one at a time, in submission order, so the
+ * action may use self->state without locks; jobs of different nodes
+ * run concurrently. Pulse-arena inputs and batches (coalesced ones
+ * included) are copied into the job, and an output returning that
+ * copy is handed on as a message of the delivering pulse. Other raw
+ * pointer inputs must stay valid until the job has completed.
+ * ============================================================================
+ */
+
+#define FLUXION_ASYNC_DEFAULT_WORKERS 4
+
+typedef struct FluxionAsync FluxionAsync;
+
+/**
+ * @brief One submission of an async node
+ */
+typedef struct FluxionAsyncJob {
+    Node* node;
+    void* data;                  // Input: the node's payload, or `copy`
+    size_t count;                // Batch size of `data` (0 = single payload)
+    size_t stride;
+    void* copy;                  // Owned copy of a pulse-arena input
+    size_t copy_size;
+    void* output;                // Returned by the action
+    uint64_t pulse_id;           // Submitting pulse
+    uint64_t submit_ticks;       // Submission, in ticks (timed jobs only)
+    uint64_t run_begin;          // Action run, in ticks
+    uint64_t run_end;
+    unsigned worker;             // I/O worker that ran the job
+    int timed;                   // Submitted while tracing or profiling
+    struct FluxionAsyncJob* next; // Queue, backlog or completion link
+} FluxionAsyncJob;
+
+/**
+ * @brief Jobs of one async node (cold: allocated at its first submission)
+ */
+typedef struct FluxionAsyncNode {
+    int running;                 // A worker owns the node's jobs
+    FluxionAsyncJob* backlog;    // Submitted while running, in order
+    FluxionAsyncJob* backlog_tail;
+    uint64_t delivered_pulse;    // Last pulse that delivered an output (context thread)
+} FluxionAsyncNode;
+
+/**
+ * @brief Async statistics (approximate while jobs are running)
+ */
+typedef struct {
+    uint64_t submitted;          // Jobs submitted by pulses
+    uint64_t completed;          // Jobs whose action has returned
+    uint64_t delivered;          // Completions handed to subscribers
+    uint64_t in_flight;          // Submitted, not yet delivered
+} FluxionAsyncStats;
+
+/* ============================================================================
+ * ASYNC API
+ * ============================================================================
+ */
+
+/**
+ * @brief Sizes the I/O workers of a context
+ *
+ * Without a call, FLUXION_ASYNC_DEFAULT_WORKERS are started by the
+ * first submission.
+ *
+ * @return FLUXION_ERR_INVALID_ARGUMENT if `workers` is 0 or jobs are in flight
+ */
+FluxionError fluxion_set_async_workers(FluxionContext* ctx, unsigned workers);
+
+/**
+ * @brief Delivers completed jobs, running a pulse if there are any
+ *
+ * The pulse runs the ready queue whatever the context's scheduling,
+ * which is left unchanged: with full-scan scheduling it runs the nodes
+ * queued since the last pulse, those activated by the outputs included.
+ *
+ * @return Number of completions delivered
+ */
+size_t fluxion_async_poll(FluxionContext* ctx);
+
+/**
+ * @brief Polls until no job is in flight, sleeping between completions
+ *
+ * Jobs submitted by the delivering pulses are waited for as well.
+ *
+ * @return Number of completions delivered
+ */
+size_t fluxion_async_wait(FluxionContext* ctx);
+
+/**
+ * @brief Reads the async statistics of a context
+ */
+FluxionAsyncStats fluxion_async_stats(const FluxionContext* ctx);
+
+/**
+ * @brief Submits the input of an async node (runtime hook)
+ *
+ * Thread-safe: parallel pulses submit from their workers.
+ */
+FluxionError fluxion_async_submit(FluxionContext* ctx, Node* n);
+
+/**
+ * @brief Takes the deferred then the completed jobs, oldest first, linked by `next` (runtime hook)
+ */
+FluxionAsyncJob* fluxion_async_take(FluxionAsync* a);
+
+/**
+ * @brief Holds a taken job for the next pulse (runtime hook)
+ */
+void fluxion_async_defer(FluxionAsync* a, FluxionAsyncJob* job);
+
+/**
+ * @brief Recycles a delivered job and its input copy (runtime hook)
+ */
+void fluxion_async_done(FluxionAsync* a, FluxionAsyncJob* job);
+
+/**
+ * @brief Waits for the running jobs, stops the workers and drops undelivered completions
+ */
+void fluxion_async_destroy(FluxionAsync* a);
+
+/**
+ * @brief Frees the job queue of a node (see fluxion_node_cleanup())
+ *
+ * The node must have no job in flight.
+ */
+void fluxion_async_node_destroy(Node* n);
+
+#endif /* FLUXION_ASYNC_H */
@@ -0,0 +1,111 @@
+#ifndef FLUXION_BUILDER_H
+#define FLUXION_BUILDER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "fluxion_node.h"
+#include "fluxion_runtime.h"
+
+/* ============================================================================
+ * FLUXION — GRAPH BUILDER
+ *
+ * Bulk construction of large graphs:
+ * - Nodes are indexed by UID (hash table, O(1) lookup)
+ * - Edges are indexed by (source, destination), so unlinking is O(1);
+ *   the index is built on the first unlink or single link
+ * - Edge lists are inserted in bulk, reserving every subscriber
+ *   array once before filling it
+ *
+ * While a builder manages a set of nodes, their links must be edited
+ * through it (fluxion_link() and fluxion_node_unlink() bypass the index).
+ * ============================================================================
+ */
+
+struct FluxionUidSlot;  // UID index entry (internal)
+struct FluxionEdgeSlot; // Edge index entry (internal)
+
+/**
+ * @brief Edge between two nodes, identified by UID
+ */
+typedef struct {
+    uint32_t src;
+    uint32_t dst;
+} FluxionEdge;
+
+/**
+ * @brief Graph builder with UID and edge indexes
+ */
+typedef struct {
+    struct FluxionUidSlot* nodes;  // Open-addressing table: UID -> node
+    size_t node_count;
+    size_t node_capacity;          // Power of two
+
+    struct FluxionEdgeSlot* edges; // Open-addressing table: edge -> subscriber slot
+    size_t edge_count;
+    size_t edge_capacity;          // Power of two (0 = not allocated yet)
+    int edges_indexed;             // Edge table built (first unlink or single link)
+
+    uint64_t stamp;                // Last bulk edge group
+} FluxionBuilder;
+
+/* ============================================================================
+ * BUILDER API
+ * ============================================================================
+ */
+
+/**
+ * @brief Creates a builder sized for about `expected_nodes` nodes
+ */
+FluxionBuilder* fluxion_builder_create(size_t expected_nodes);
+
+/**
+ * @brief Frees the indexes (the nodes and their links are untouched)
+ */
+void fluxion_builder_destroy(FluxionBuilder* b);
+
+/**
+ * @brief Registers a node under its UID
+ *
+ * Links the node already has are indexed as well.
+ *
+ * @return FLUXION_ERR_INVALID_ARGUMENT if another node has the same UID
+ */
+FluxionError fluxion_builder_add(FluxionBuilder* b, Node* n);
+
+/**
+ * @brief Registers `count` nodes (NULL entries are skipped)
+ */
+FluxionError fluxion_builder_add_nodes(FluxionBuilder* b, Node* nodes[], size_t count);
+
+/**
+ * @brief Finds a registered node by UID (NULL if unknown)
+ */
+Node* fluxion_builder_find(const FluxionBuilder* b, uint32_t uid);
+
+/**
+ * @brief Links two registered nodes (an existing edge is kept as is)
+ */
+FluxionError fluxion_builder_link(FluxionBuilder* b, uint32_t src, uint32_t dst);
+
+/**
+ * @brief Links a whole edge list
+ *
+ * Every subscriber array grows at most once. Endpoints are validated
+ * first: if a UID is unknown, no edge of the list is added. Edges that
+ * agree with the topological order go in first, in O(1) each; the
+ * others are then checked one by one. An edge that would close a
+ * cycle is skipped (FLUXION_ERR_CYCLE_DETECTED is returned once the
+ * other edges are in). Repeated edges are added once.
+ */
+FluxionError fluxion_builder_link_bulk(FluxionBuilder* b, const FluxionEdge* edges, size_t count);
+
+/**
+ * @brief Removes a link in O(1)
+ *
+ * The last subscriber of the source takes the place of the removed
+ * one, so subscription order is not preserved.
+ */
+FluxionError fluxion_builder_unlink(FluxionBuilder* b, uint32_t src, uint32_t dst);
+
+#endif /* FLUXION_BUILDER_H */
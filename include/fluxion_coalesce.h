@@ -0,0 +1,141 @@
+#ifndef FLUXION_COALESCE_H
+#define FLUXION_COALESCE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "fluxion_node.h"
+#include "fluxion_runtime.h"
+
+/* ============================================================================
+ * FLUXION — EMIT COALESCING
+ *
+ * A coalescing source does not propagate on every fluxion_emit(): its
+ * emissions are held and merged until the next pulse starts, which
+ * then propagates them once:
+ * - LATEST:     the last emitted payload wins
+ * - ACCUMULATE: payloads are copied into a batch, emitted as a whole
+ * - MAX_RATE:   LATEST, propagated at most once per time window
+ *
+ * A window also applies to LATEST and ACCUMULATE: the held emission
+ * waits for the first pulse at least `window_ns` after the previous
+ * propagation. Held pulse-arena messages survive the end of their
+ * pulse (they are copied aside, then propagate as a new message of the
+ * flushing pulse), and the emitter's reference moves to the source.
+ * ============================================================================
+ */
+
+typedef enum {
+    FLUXION_COALESCE_NONE = 0,    // Every emission propagates
+    FLUXION_COALESCE_LATEST,      // Latest value wins
+    FLUXION_COALESCE_ACCUMULATE,  // Every value, as one batch
+    FLUXION_COALESCE_MAX_RATE     // Latest value, once per window
+} FluxionCoalescePolicy;
+
+/**
+ * @brief Coalescing counters of a source
+ */
+typedef struct {
+    uint64_t emits;       // Emissions received
+    uint64_t coalesced;   // Emissions merged into a held one (no propagation of their own)
+    uint64_t flushes;     // Propagations started
+} FluxionCoalesceStats;
+
+/**
+ * @brief Coalescing state of a source node (cold: allocated on demand)
+ */
+typedef struct FluxionCoalesce {
+    FluxionCoalescePolicy policy;
+    uint64_t window_ns;          // Minimum time between two propagations (0 = every pulse)
+    uint64_t last_flush_ns;
+
+    /* --- Held emission --- */
+    int pending;                 // Waiting on the context's list
+    Node* pending_next;          // Next held source of the context
+    FluxionContext* pending_ctx; // Context holding the emission
+    void* data;                  // Latest payload (LATEST, MAX_RATE)
+    size_t count;                // Batch size of `data`, or items accumulated
+    size_t stride;
+    int msg;                     // `data` is a pulse-arena message (reference held)
+
+    /* --- Accumulated items (double-buffered: one filling, one in flight) --- */
+    unsigned char* items[2];
+    size_t items_capacity[2];    // In items
+    size_t item_size;
+    int filling;
+
+    /* --- Copies of messages held past their pulse --- */
+    unsigned char* spill;
+    size_t spill_capacity;
+    size_t spilled;              // Bytes of `data` held in `spill` (0 = not spilled)
+
+    FluxionCoalesceStats stats;
+} FluxionCoalesce;
+
+/* ============================================================================
+ * COALESCING API
+ * ============================================================================
+ */
+
+/**
+ * @brief Sets the coalescing policy of a source node
+ *
+ * ACCUMULATE needs a registered type size (see fluxion_type_register()).
+ * MAX_RATE needs a window. FLUXION_COALESCE_NONE restores plain
+ * emissions once the held one has been propagated.
+ *
+ * @return FLUXION_ERR_INVALID_ARGUMENT if the policy cannot apply to the node
+ */
+FluxionError fluxion_set_coalescing(Node* n, FluxionCoalescePolicy policy, uint64_t window_ns);
+
+/**
+ * @brief Reads the coalescing counters of a node (zero if it never coalesced)
+ */
+FluxionCoalesceStats fluxion_coalesce_stats(const Node* n);
+
+/**
+ * @brief Merges an emission into the held one (runtime hook)
+ *
+ * Takes over the emitter's message reference (ACCUMULATE copies the
+ * payload and drops it).
+ */
+FluxionError fluxion_coalesce_hold(FluxionCoalesce* c, void* data, size_t count, size_t stride, int msg);
+
+/**
+ * @brief Whether the held emission may propagate at time `now`
+ */
+int fluxion_coalesce_due(const FluxionCoalesce* c, uint64_t now);
+
+/**
+ * @brief Hands the held emission over for propagation (runtime hook)
+ *
+ * An accumulated batch stays valid until the next take. A spilled
+ * value is handed over as a new message of `arena`, so that readers
+ * outliving the pulse (async jobs) copy it like any message.
+ */
+void fluxion_coalesce_take(
+    FluxionCoalesce* c,
+    FluxionArena* arena,
+    uint64_t now,
+    void** data,
+    size_t* count,
+    size_t* stride,
+    int* msg
+);
+
+/**
+ * @brief Copies a held message aside before its arena is reset (runtime hook)
+ */
+void fluxion_coalesce_spill(FluxionCoalesce* c);
+
+/**
+ * @brief Discards the held emission
+ */
+void fluxion_coalesce_drop(FluxionCoalesce* c);
+
+/**
+ * @brief Frees the coalescing state of a node (see fluxion_node_cleanup())
+ */
+void fluxion_coalesce_destroy(Node* n);
+
+#endif /* FLUXION_COALESCE_H */
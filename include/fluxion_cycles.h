@@ -0,0 +1,87 @@
+#ifndef FLUXION_CYCLES_H
+#define FLUXION_CYCLES_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "fluxion_node.h"
+#include "fluxion_runtime.h"
+
+/* ============================================================================
+ * FLUXION — CYCLE DETECTION
+ *
+ * Link time: every linked node carries an online topological order
+ * (topo_order). An edge that agrees with the order is accepted in O(1);
+ * otherwise a forward search bounded by the order either finds a cycle,
+ * which rejects the edge, or renumbers the nodes it reached.
+ *
+ * Audit: a full Tarjan pass lists the strongly connected components
+ * that form cycles (e.g. adjacency edited by hand, bypassing
+ * fluxion_link()).
+ * ============================================================================
+ */
+
+/**
+ * @brief One cycle: the members of a strongly connected component
+ */
+typedef struct {
+    Node** members;
+    size_t count;
+} FluxionCycle;
+
+/**
+ * @brief Every cycle of a graph
+ */
+typedef struct {
+    FluxionCycle* cycles;
+    size_t cycle_count;
+    Node** storage;      // Members of every cycle, contiguous
+} FluxionCycleReport;
+
+/* ============================================================================
+ * CYCLE API
+ * ============================================================================
+ */
+
+/**
+ * @brief Maintains the topological order for a new edge src -> dst
+ *
+ * Called by fluxion_link() before the edge is added. Threads may link
+ * unrelated graphs concurrently; one graph is linked by one thread at
+ * a time.
+ *
+ * @return FLUXION_ERR_CYCLE_DETECTED if the edge would close a cycle
+ */
+FluxionError fluxion_topo_insert(Node* src, Node* dst);
+
+/**
+ * @brief Version of the topology, bumped by every link and unlink
+ *
+ * Cache key for whole-graph analyses (see fluxion_inspect()). Edits of
+ * subscriber arrays made by hand must call fluxion_topology_changed().
+ */
+uint64_t fluxion_topology_version(void);
+
+/**
+ * @brief Invalidates the analyses keyed by fluxion_topology_version()
+ */
+void fluxion_topology_changed(void);
+
+/**
+ * @brief Finds every cycle among graph[] (Tarjan's SCC algorithm)
+ *
+ * Subscribers outside graph[] are ignored. A component is a cycle
+ * when it has several members or a node subscribes to itself.
+ * Runs in O(nodes + edges) without recursion.
+ *
+ * @return A report to release with fluxion_cycle_report_free()
+ *         (empty if memory is exhausted)
+ */
+FluxionCycleReport fluxion_detect_cycles(Node* graph[], size_t count);
+
+/**
+ * @brief Releases a cycle report
+ */
+void fluxion_cycle_report_free(FluxionCycleReport* report);
+
+#endif /* FLUXION_CYCLES_H */
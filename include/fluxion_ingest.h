@@ -0,0 +1,173 @@
+#ifndef FLUXION_INGEST_H
+#define FLUXION_INGEST_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "fluxion_node.h"
+#include "fluxion_runtime.h"
+
+/* ============================================================================
+ * FLUXION — INGESTION QUEUE
+ *
+ * A FluxionContext belongs to one thread. Other threads (network, IO...)
+ * hand their emissions to an ingestion queue instead:
+ * - Producers push (node, payload) pairs into a bounded lock-free ring,
+ *   from any number of threads
+ * - A single consumer, the context's thread, drains the ring into pulses
+ *
+ * Payloads are emitted as raw pointers (see fluxion_emit()): they must
+ * stay valid until the pulse that consumes them has run.
+ *
+ * When producers outrun the pulses, a shedding policy drops items
+ * instead of blocking producers:
+ * - DROP_NEWEST: above the watermark, incoming items are refused
+ * - DROP_OLDEST: above the watermark, the oldest queued item is evicted
+ *                for each incoming one
+ * - PRIORITY:    above the watermark, only items of priority
+ *                `shed_priority` or higher are admitted
+ * - SAMPLE:      above the watermark, one item in `sample_every` is admitted
+ * A ring that is full despite the policy refuses the newest item.
+ * Shed payloads are never emitted: `on_shed` may release them.
+ * ============================================================================
+ */
+
+typedef enum {
+    FLUXION_SHED_NONE = 0,    // Producers wait (push) or fail (try_push) on a full ring
+    FLUXION_SHED_DROP_NEWEST, // Refuse incoming items
+    FLUXION_SHED_DROP_OLDEST, // Evict the oldest queued items
+    FLUXION_SHED_PRIORITY,    // Refuse incoming items below a priority
+    FLUXION_SHED_SAMPLE       // Admit one incoming item in N
+} FluxionShedPolicy;
+
+/**
+ * @brief Called on the thread that sheds an item (producer, or evicting producer)
+ */
+typedef void (*FluxionShedHook)(Node* target, void* data, void* user);
+
+/**
+ * @brief Ingestion queue settings
+ */
+typedef struct {
+    size_t capacity;          // Ring slots (rounded up to a power of two)
+    size_t drain_batch;       // Most items emitted by one drain
+    FluxionWaitPolicy wait;   // How an idle consumer (or a producer facing a full ring) waits
+    unsigned spin_limit;      // Attempts before yielding
+    unsigned yield_limit;     // Yields before parking (FLUXION_WAIT_PARK)
+
+    /* --- Load shedding --- */
+    FluxionShedPolicy shed;   // What to do when the consumer falls behind
+    size_t shed_watermark;    // Queued items above which shedding starts (0 = a full ring)
+    unsigned shed_priority;   // PRIORITY: lowest priority admitted above the watermark
+    unsigned sample_every;    // SAMPLE: one item admitted in N above the watermark
+    FluxionShedHook on_shed;  // Optional, receives every shed payload
+    void* shed_user;
+} FluxionIngestConfig;
+
+typedef struct FluxionIngest FluxionIngest;
+
+/**
+ * @brief Queue statistics (approximate while producers are running)
+ */
+typedef struct {
+    uint64_t pushed;          // Items accepted
+    uint64_t rejected;        // fluxion_ingest_try_push() calls that found the ring full
+    uint64_t drained;         // Items emitted by the consumer
+    uint64_t pulses;          // Pulses run by the consumer
+    uint64_t parks;           // Times the consumer went to sleep
+    uint64_t shed_newest;     // Incoming items refused (watermark, or a full ring)
+    uint64_t shed_oldest;     // Queued items evicted (DROP_OLDEST)
+    uint64_t shed_priority;   // Incoming items refused for their priority (PRIORITY)
+    uint64_t shed_sampled;    // Incoming items left out of the sample (SAMPLE)
+} FluxionIngestStats;
+
+/* ============================================================================
+ * INGEST API
+ * ============================================================================
+ */
+
+/**
+ * @brief Default settings: 4096 slots, 256 items per drain, FLUXION_WAIT_PARK,
+ *        no shedding
+ */
+FluxionIngestConfig fluxion_ingest_default_config(void);
+
+/**
+ * @brief Creates an ingestion queue (NULL config = defaults)
+ */
+FluxionIngest* fluxion_ingest_create(const FluxionIngestConfig* config);
+
+/**
+ * @brief Frees the queue (items still queued are dropped)
+ *
+ * No thread may use the queue anymore.
+ */
+void fluxion_ingest_destroy(FluxionIngest* q);
+
+/**
+ * @brief Enqueues an emission without waiting (any thread, lock-free)
+ *
+ * @return FLUXION_ERR_QUEUE_FULL if every slot is taken,
+ *         FLUXION_ERR_SHED if the shedding policy dropped the item,
+ *         FLUXION_ERR_QUEUE_CLOSED after fluxion_ingest_close()
+ */
+FluxionError fluxion_ingest_try_push(FluxionIngest* q, Node* target, void* data);
+
+/**
+ * @brief Enqueues an emission, waiting for a free slot (any thread)
+ *
+ * A producer facing a full ring follows the wait policy, but never
+ * parks: past the yield limit it sleeps briefly between attempts.
+ * With a shedding policy, it never waits: see fluxion_ingest_try_push().
+ *
+ * @return FLUXION_ERR_QUEUE_CLOSED if the queue is closed meanwhile
+ */
+FluxionError fluxion_ingest_push(FluxionIngest* q, Node* target, void* data);
+
+/**
+ * @brief Enqueues an emission of a given priority (any thread, lock-free)
+ *
+ * Only FLUXION_SHED_PRIORITY reads the priority; plain pushes have
+ * priority 0, the first to be shed.
+ *
+ * @return As fluxion_ingest_try_push()
+ */
+FluxionError fluxion_ingest_push_priority(FluxionIngest* q, Node* target, void* data, unsigned priority);
+
+/**
+ * @brief Emits up to `drain_batch` queued items, then runs the pulse
+ *
+ * Consumer thread only. Items are emitted in queue order; an item for
+ * a node already activated by the current pulse first closes that
+ * pulse, so no payload is dropped by the once-per-pulse rule. Requires
+ * ready-queue scheduling. Errors are reported in ctx->last_error.
+ *
+ * @return Number of items emitted (0 if the ring was empty)
+ */
+size_t fluxion_ingest_drain(FluxionContext* ctx, FluxionIngest* q);
+
+/**
+ * @brief Drains the queue until it is closed and empty
+ *
+ * Consumer thread only. Between bursts, the thread waits according to
+ * the wait policy; a parked consumer is woken by the next push.
+ *
+ * @return Total number of items emitted
+ */
+size_t fluxion_ingest_run(FluxionContext* ctx, FluxionIngest* q);
+
+/**
+ * @brief Rejects further pushes and wakes the consumer
+ *
+ * Items already queued are still drained by fluxion_ingest_run().
+ * Call it once producers are done: a push racing with the close may
+ * be left in the queue.
+ */
+void fluxion_ingest_close(FluxionIngest* q);
+
+/**
+ * @brief Reads the queue statistics
+ */
+FluxionIngestStats fluxion_ingest_stats(const FluxionIngest* q);
+
+#endif /* FLUXION_INGEST_H */
@@ -0,0 +1,153 @@
+#ifndef FLUXION_JOIN_H
+#define FLUXION_JOIN_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "fluxion_node.h"
+#include "fluxion_runtime.h"
+
+/* ============================================================================
+ * FLUXION — JOIN NODES (FAN-IN)
+ *
+ * A join node has a fixed number of typed input slots instead of a
+ * single input_buffer. Every inbound edge is bound to a slot, and each
+ * delivery fills its slot, so several branches reaching the node in
+ * one pulse (or across pulses) no longer overwrite each other.
+ *
+ * The firing policy decides when the join action runs:
+ * - ALL:    barrier; fires once every slot is filled, then empties them
+ * - ANY:    fires on any delivery, then empties the slots
+ * - LATEST: fires on any delivery once every slot has been filled;
+ *           slots keep their latest payload
+ *
+ * The action receives the slot array itself (no copy) and a bitmask
+ * of the slots delivered since the previous firing. Payloads persist
+ * across pulses like emitted pointers, except pulse-arena messages,
+ * which expire with their pulse.
+ *
+ * Propagation stops at a join, as at an async node: a delivery fills a
+ * slot and activates the join, never its subscribers. Under every
+ * execution policy, the subscribers are activated when the join fires,
+ * with the pointer its action returns (FLUXION_NO_OUTPUT leaves them
+ * asleep). Firing during a pulse, a join wakes them within that pulse;
+ * under FLUXION_EXEC_PARALLEL, joins run on the pulse's thread.
+ * ============================================================================
+ */
+
+#define FLUXION_JOIN_MAX_SLOTS  32
+#define FLUXION_JOIN_NEXT_SLOT  UINT32_MAX   // fluxion_join_bind(): first slot without a source
+
+typedef enum {
+    FLUXION_JOIN_ALL = 0,   // Barrier: every slot
+    FLUXION_JOIN_ANY,       // Any delivered slot
+    FLUXION_JOIN_LATEST     // Any delivered slot, latest payload of each
+} FluxionJoinPolicy;
+
+/**
+ * @brief An inbound edge and the slot it fills
+ */
+typedef struct {
+    Node* src;
+    uint32_t slot;
+} FluxionJoinSource;
+
+/**
+ * @brief Input slots of a join node
+ */
+typedef struct FluxionJoin {
+    FluxionJoinPolicy policy;
+    uint32_t slot_count;
+    uint32_t filled;                                  // Slots holding a payload
+    uint32_t fresh;                                   // Slots delivered since the last firing
+    uint32_t msgs;                                    // Slots holding a pulse-arena message
+    uint32_t held;                                    // Slots owning a message reference
+    void* slots[FLUXION_JOIN_MAX_SLOTS];              // Passed as-is to the join action
+    uint64_t slot_pulse[FLUXION_JOIN_MAX_SLOTS];      // Pulse of the last delivery
+    FluxionTypeId slot_types[FLUXION_JOIN_MAX_SLOTS]; // FLUXION_TYPE_NONE = untyped
+
+    FluxionJoinSource* sources;                       // Bound edges (fan-in is small: linear scans)
+    size_t source_count;
+    size_t source_capacity;
+} FluxionJoin;
+
+/* ============================================================================
+ * JOIN API
+ * ============================================================================
+ */
+
+/**
+ * @brief Gives a node `slot_count` input slots and a firing policy
+ *
+ * The node should be initialized with JOIN_NODE_INIT(). `slot_types`
+ * (optional) names the type of each slot; NULL entries are untyped.
+ * Reconfiguring a join drops its slots and bindings.
+ *
+ * @return FLUXION_ERR_INVALID_ARGUMENT if slot_count is 0 or above FLUXION_JOIN_MAX_SLOTS
+ */
+FluxionError fluxion_join_configure(
+    Node* n,
+    FluxionJoinPolicy policy,
+    uint32_t slot_count,
+    const char* const slot_types[]
+);
+
+/**
+ * @brief Binds the edge src -> join to a slot
+ *
+ * Called by fluxion_link() with FLUXION_JOIN_NEXT_SLOT; an edge that
+ * is already bound keeps its slot. Several sources may share a slot.
+ *
+ * @return FLUXION_ERR_TYPE_MISMATCH if src's type does not fit the slot,
+ *         FLUXION_ERR_INVALID_ARGUMENT if no slot is left or `slot` is out of range
+ */
+FluxionError fluxion_join_bind(Node* join, Node* src, uint32_t slot);
+
+/**
+ * @brief Forgets the binding of src (see fluxion_node_unlink())
+ */
+void fluxion_join_unbind(Node* join, Node* src);
+
+/**
+ * @brief Slot bound to src, or -1
+ */
+int fluxion_join_slot_of(const FluxionJoin* j, const Node* src);
+
+/**
+ * @brief Fills a slot (runtime hook)
+ *
+ * A message (`msg` set) is retained by the slot until the join fires
+ * or the slot is overwritten.
+ */
+void fluxion_join_deliver(FluxionJoin* j, uint32_t slot, void* data, int msg, uint64_t pulse);
+
+/**
+ * @brief Replaces a message in the slot bound to src (copy-on-write forwarding)
+ */
+void fluxion_join_rewrite(FluxionJoin* j, const Node* src, void* previous, void* data, uint64_t pulse);
+
+/**
+ * @brief Checks the firing policy for the current pulse
+ * @return The mask passed to the join action, or 0 if the join does not fire
+ */
+uint32_t fluxion_join_ready(FluxionJoin* j, uint64_t pulse);
+
+/**
+ * @brief Applies the policy after a firing (empties or keeps the slots)
+ *
+ * Message references are dropped, except the one of `keep`, which
+ * becomes the reference of the join's output.
+ */
+void fluxion_join_consume(FluxionJoin* j, const void* keep);
+
+/**
+ * @brief Empties every slot, keeping the bindings
+ */
+void fluxion_join_reset(Node* n);
+
+/**
+ * @brief Frees the slots of a node (see fluxion_node_cleanup())
+ */
+void fluxion_join_destroy(Node* n);
+
+#endif /* FLUXION_JOIN_H */
@@ -0,0 +1,111 @@
+#ifndef FLUXION_LOG_H
+#define FLUXION_LOG_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "fluxion_runtime.h"
+
+/* ============================================================================
+ * FLUXION — PULSE LOG
+ *
+ * A per-context binary log: every pulse appends one fixed-size record
+ * to a single-producer ring, and a writer thread drains the ring to the
+ * file in batches. The pulse never touches the file: a full ring drops
+ * the record (counted) instead of blocking.
+ *
+ * Pulses time themselves with the CPU's timestamp counter where there
+ * is one (x86), which is cheaper than a clock read; the writer converts
+ * ticks to fluxion_time_ns() nanoseconds by interpolating between the
+ * clock readings it takes at every batch.
+ *
+ * File layout (host byte order): one FluxionLogHeader, then
+ * FluxionLogRecord entries. tools/fluxion_log2csv.c converts a log to CSV.
+ * ============================================================================
+ */
+
+#define FLUXION_LOG_MAGIC     "FLUXLOG"
+#define FLUXION_LOG_VERSION   1
+#define FLUXION_LOG_CAPACITY  4096   // Records buffered in the ring (power of two)
+#define FLUXION_LOG_FLUSH_MS  10     // Longest time a record waits in the ring
+
+typedef struct FluxionLog FluxionLog;
+
+/**
+ * @brief First bytes of a log file
+ *
+ * Both clocks are read together when logging starts: record times are
+ * monotonic, and converted to wall-clock time with this pair.
+ */
+typedef struct {
+    char magic[8];                // FLUXION_LOG_MAGIC
+    uint32_t version;             // FLUXION_LOG_VERSION
+    uint32_t record_size;         // sizeof(FluxionLogRecord)
+    uint64_t realtime_ns;         // Wall clock (ns since the epoch)
+    uint64_t monotonic_ns;        // fluxion_time_ns() at the same instant
+} FluxionLogHeader;
+
+/**
+ * @brief One pulse
+ */
+typedef struct {
+    uint64_t pulse_id;
+    uint64_t start_ns;            // fluxion_time_ns() when the pulse started
+    uint64_t duration_ns;
+    uint64_t total_executed;      // ctx->executed_nodes after the pulse
+    uint32_t ready_nodes;         // Nodes made ready for the pulse
+    uint32_t executed_nodes;      // Actions executed by the pulse
+    uint32_t policy;              // FluxionExecPolicy
+    int32_t last_error;           // FluxionError after the pulse
+} FluxionLogRecord;
+
+/**
+ * @brief Logger counters
+ */
+typedef struct {
+    uint64_t logged;              // Records appended by pulses
+    uint64_t written;             // Records written to the file
+    uint64_t dropped;             // Records lost to a full ring
+} FluxionLogStats;
+
+/* ============================================================================
+ * LOG API
+ * ============================================================================
+ */
+
+/**
+ * @brief Starts logging every pulse of a context to a binary file
+ *
+ * The file is truncated. Calling again with the same path keeps the
+ * running log; another path closes it and starts a new one.
+ *
+ * @return FLUXION_ERR_INVALID_ARGUMENT if the file cannot be opened
+ */
+FluxionError fluxion_enable_logging(FluxionContext* ctx, const char* path);
+
+/**
+ * @brief Writes the buffered records, stops the writer and closes the file
+ */
+void fluxion_disable_logging(FluxionContext* ctx);
+
+/**
+ * @brief Reads the logger counters (zero if not logging)
+ */
+FluxionLogStats fluxion_log_stats(const FluxionContext* ctx);
+
+/**
+ * @brief Notes the start of a pulse (runtime hook)
+ */
+void fluxion_log_begin(FluxionLog* log);
+
+/**
+ * @brief Appends the record of the ending pulse (runtime hook)
+ */
+void fluxion_log_pulse(FluxionContext* ctx);
+
+/**
+ * @brief Flushes and frees a logger (runtime hook)
+ */
+void fluxion_log_destroy(FluxionLog* log);
+
+#endif /* FLUXION_LOG_H */
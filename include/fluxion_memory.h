@@ -0,0 +1,189 @@
+#ifndef FLUXION_MEMORY_H
+#define FLUXION_MEMORY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* ============================================================================
+ * FLUXION — MEMORY
+ *
+ * Pulse arena: a bump allocator owned by the context, reset in bulk
+ * when a pulse ends. Chunks are kept across pulses, so steady-state
+ * pulses never go back to the system allocator.
+ *
+ * Messages: ref-counted payloads allocated from an arena. They are
+ * shared along edges without copies and duplicated only on write
+ * (copy-on-write) while another reader still holds them.
+ *
+ * State slab: size-class allocator for persistent node state. Blocks
+ * of one class are carved from shared pages, freed blocks are recycled
+ * through per-class free lists, and a plan's states can be packed into
+ * one contiguous region.
+ * ============================================================================
+ */
+
+#define FLUXION_ARENA_ALIGN      16
+#define FLUXION_ARENA_CHUNK_SIZE (64 * 1024)
+
+#define FLUXION_SLAB_MIN_BLOCK 16
+#define FLUXION_SLAB_CLASSES   9            // 16 B .. 4 KiB, powers of two
+#define FLUXION_SLAB_PAGE_SIZE (16 * 1024)
+
+struct FluxionArenaChunk; // Chunk of arena memory (internal)
+struct FluxionChunkIndex; // Address index of the arena chunks (internal)
+struct FluxionSlabPage;   // Page or packed region of a slab (internal)
+
+/**
+ * @brief Bump allocator with bulk reset
+ */
+typedef struct {
+    struct FluxionArenaChunk* chunks;   // Every chunk ever allocated
+    struct FluxionArenaChunk* current;  // Chunk being filled
+    size_t chunk_size;                  // Default chunk size (power of two, chunks are aligned on it)
+    unsigned chunk_shift;               // log2(chunk_size)
+    struct FluxionChunkIndex* index;    // Chunks by address, read without the lock
+    size_t allocated_bytes;             // Bytes handed out since the last reset
+    size_t messages;                    // Messages created since the last reset
+    uint64_t generation;                // Resets so far (stamped on messages)
+    int lock;                           // Spinlock (parallel pulses allocate too)
+} FluxionArena;
+
+/**
+ * @brief Size-class allocator for node state
+ *
+ * Requests larger than the biggest class go to the system allocator.
+ */
+typedef struct FluxionSlab {
+    struct FluxionSlabPage* pages;                  // Every page and packed region
+    void* free_lists[FLUXION_SLAB_CLASSES];         // Recycled blocks per class
+    unsigned char* bump[FLUXION_SLAB_CLASSES];      // Next never-used block per class
+    unsigned char* bump_end[FLUXION_SLAB_CLASSES];
+    size_t live_blocks;                             // Blocks currently handed out
+    int lock;                                       // Spinlock (parallel actions set state)
+} FluxionSlab;
+
+/* ============================================================================
+ * ARENA API
+ * ============================================================================
+ */
+
+/**
+ * @brief Initializes an empty arena (no memory is reserved yet)
+ *
+ * `chunk_size` is rounded up to a power of two.
+ */
+void fluxion_arena_init(FluxionArena* arena, size_t chunk_size);
+
+/**
+ * @brief Allocates `size` bytes aligned on FLUXION_ARENA_ALIGN
+ * @return NULL if memory is exhausted
+ */
+void* fluxion_arena_alloc(FluxionArena* arena, size_t size);
+
+/**
+ * @brief Frees every allocation at once, keeping the chunks for reuse
+ */
+void fluxion_arena_reset(FluxionArena* arena);
+
+/**
+ * @brief Returns the chunks to the system allocator
+ */
+void fluxion_arena_release(FluxionArena* arena);
+
+/* ============================================================================
+ * MESSAGE API
+ * ============================================================================
+ */
+
+/**
+ * @brief Allocates a message payload of `size` bytes
+ *
+ * The payload starts with one reference, owned by the caller.
+ */
+void* fluxion_msg_create(FluxionArena* arena, size_t size);
+
+/**
+ * @brief Checks whether a pointer is a message created since the last reset
+ *
+ * Only the exact payload start qualifies: pointers inside a message
+ * (a field, `msg + 1`) are plain data. Constant time and lock-free:
+ * chunks are aligned on the arena's chunk size and indexed by address,
+ * so the header in front of `ptr` is read only when it lies in a chunk.
+ */
+int fluxion_msg_is(FluxionArena* arena, const void* ptr);
+
+/**
+ * @brief Allocates a new message holding a copy of `payload`
+ */
+void* fluxion_msg_clone(const void* payload);
+
+/**
+ * @brief Adds a reference to a message
+ */
+void fluxion_msg_retain(void* payload);
+
+/**
+ * @brief Drops a reference to a message
+ *
+ * Memory is reclaimed in bulk by the arena reset; the count only
+ * tells writers whether they are the last reader.
+ */
+void fluxion_msg_release(void* payload);
+
+/**
+ * @brief Current number of references
+ */
+uint32_t fluxion_msg_refs(const void* payload);
+
+/**
+ * @brief Payload size in bytes
+ */
+size_t fluxion_msg_size(const void* payload);
+
+/* ============================================================================
+ * STATE SLAB API
+ * ============================================================================
+ */
+
+/**
+ * @brief Initializes an empty slab (no memory is reserved yet)
+ */
+void fluxion_slab_init(FluxionSlab* slab);
+
+/**
+ * @brief Block size used for a request, or 0 if it bypasses the slab
+ */
+size_t fluxion_slab_block_size(size_t size);
+
+/**
+ * @brief Allocates a block able to hold `size` bytes
+ */
+void* fluxion_slab_alloc(FluxionSlab* slab, size_t size);
+
+/**
+ * @brief Returns a block to its class (`size` is the requested size)
+ */
+void fluxion_slab_free(FluxionSlab* slab, void* block, size_t size);
+
+/**
+ * @brief Reserves a contiguous region for packing blocks
+ *
+ * The region is carved by the caller into blocks of
+ * fluxion_slab_block_size(); each of them can later be
+ * released with fluxion_slab_free().
+ */
+void* fluxion_slab_alloc_region(FluxionSlab* slab, size_t bytes);
+
+/**
+ * @brief Counts blocks carved by the caller from a packed region
+ */
+void fluxion_slab_adopt(FluxionSlab* slab, size_t blocks);
+
+/**
+ * @brief Returns every page to the system allocator
+ *
+ * Blocks still referenced by nodes become invalid.
+ */
+void fluxion_slab_release(FluxionSlab* slab);
+
+#endif /* FLUXION_MEMORY_H */
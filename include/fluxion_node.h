@@ -5,6 +5,8 @@
 #include <stdint.h>
 #include <stddef.h>
 
+#include "fluxion_types.h"
+
 /* ============================================================================
  * FLUXION — NODE CORE
  * A node is a dormant reactive entity.
@@ -15,6 +17,11 @@
 /* --- BASIC TYPES --- */
 
 typedef struct Node Node;
+struct FluxionSlab; // State allocator (see fluxion_memory.h)
+struct FluxionJoin; // Input slots of a join node (see fluxion_join.h)
+struct FluxionCoalesce; // Held emissions of a source (see fluxion_coalesce.h)
+struct FluxionAsyncNode; // Jobs of an async node (see fluxion_async.h)
+struct FluxionProfile; // Latency histograms of a node (see fluxion_profile.h)
 
 /**
  * @brief Signature of a Fluxion node logic
@@ -23,6 +30,47 @@ typedef struct Node Node;
  */
 typedef void (*NodeAction)(Node* self, void* data);
 
+/**
+ * @brief Signature of a batch-aware Fluxion node logic
+ * @param self The node itself
+ * @param items First item of the batch
+ * @param count Number of items
+ * @param stride Distance in bytes between two consecutive items
+ */
+typedef void (*NodeBatchAction)(Node* self, void* items, size_t count, size_t stride);
+
+/**
+ * @brief Signature of a dataflow node logic (FLUXION_EXEC_DATAFLOW)
+ * @param self The node itself
+ * @param data The data received via the flow
+ * @return Payload handed to the subscribers, or FLUXION_NO_OUTPUT to
+ *         leave them asleep for this pulse
+ */
+typedef void* (*NodeFlowAction)(Node* self, void* data);
+
+#define FLUXION_NO_OUTPUT NULL
+
+/**
+ * @brief Signature of a join node logic (see fluxion_join.h)
+ * @param self The node itself
+ * @param slots Payload of each input slot (NULL = empty), not copied
+ * @param fresh Bitmask of the slots delivered since the previous firing
+ * @return Payload handed to the subscribers, or FLUXION_NO_OUTPUT to
+ *         leave them asleep (every policy)
+ */
+typedef void* (*NodeJoinAction)(Node* self, void* const slots[], uint32_t fresh);
+
+/**
+ * @brief Signature of an async node logic (see fluxion_async.h)
+ *
+ * Runs on an I/O worker thread, where it may block.
+ * @param self The node itself
+ * @param data The data received via the flow
+ * @return Payload handed to the subscribers once the job completes,
+ *         or FLUXION_NO_OUTPUT to leave them asleep
+ */
+typedef void* (*NodeAsyncAction)(Node* self, void* data);
+
 /**
  * @brief Possible node states (for debugging & tools)
  */
@@ -33,29 +81,82 @@ typedef enum {
 } FluxionNodeState;
 
 /**
- * @brief Core structure of a Fluxion node
+ * @brief Priority classes (see fluxion_set_ordering())
  */
-struct Node {
-    /* --- Identity --- */
-    uint32_t uid;              // Stable unique identifier
-    const char* name;          // Symbolic name
-    const char* data_type;     // Expected data type (debug)
+typedef enum {
+    FLUXION_PRIORITY_BULK = 0,    // Logging, archiving: runs last
+    FLUXION_PRIORITY_NORMAL,      // Default
+    FLUXION_PRIORITY_HIGH,
+    FLUXION_PRIORITY_CRITICAL     // Alerting: runs first
+} FluxionPriority;
 
-    /* --- Behavior --- */
-    NodeAction action;         // Business logic
-    void* state;               // Persistent node memory
-    size_t state_size;         // Size of the state (optional)
+#define FLUXION_PRIORITY_CLASSES 4
 
-    /* --- Data --- */
-    void* input_buffer;        // Current received data
+#define FLUXION_NODE_ALIGN 64 // Cache line: alignment of struct Node
 
-    /* --- Execution --- */
-    FluxionNodeState state_flag; // Current node state
+/**
+ * @brief Core structure of a Fluxion node
+ *
+ * A node is the only store of its runtime state: there is no separate
+ * array-per-field graph container, since nodes are declared by value
+ * (NODE_INIT()) and every subsystem reads them through Node pointers.
+ *
+ * Fields are grouped by access frequency. The first 64 bytes are
+ * written when propagation activates the node; the next 64 are read
+ * to walk its edges and to run it. Propagation and a plain pulse
+ * touch nothing else. Optional behaviors, scheduling, identity and
+ * build-time bookkeeping come after them.
+ *
+ * The struct is aligned on FLUXION_NODE_ALIGN, so its size is a whole
+ * number of cache lines and static, automatic and array nodes start
+ * on a line: a visit costs two cache lines. malloc() and calloc() do
+ * not honor that alignment; allocate heap nodes with posix_memalign()
+ * (or aligned_alloc()), otherwise the hot fields straddle three lines.
+ */
+struct __attribute__((aligned(FLUXION_NODE_ALIGN))) Node {
+    /* --- Hot: activation (first 64 bytes) --- */
     uint64_t last_pulse_id;      // Reentrancy protection
+    FluxionNodeState state_flag; // Current node state
+    void* input_buffer;          // Current received data
+    size_t input_count;          // Items in input_buffer (0 = single payload)
+    size_t input_stride;         // Bytes between batch items
+    void* input_origin;          // Emitted message the input derives from (NULL = raw pointer)
+    int64_t input_writer;        // topo_order of the parent whose rewrite the input holds
+    struct Node* ready_next;     // Intrusive ready-queue link
 
-    /* --- Graph --- */
-    struct Node** subscribers; // Dependent nodes
+    /* --- Hot: traversal and execution (next 64 bytes) --- */
+    struct Node** subscribers;   // Dependent nodes
+    uint64_t* edge_transfers;    // Inputs handed along each subscriber edge (parallel array)
     size_t subscriber_count;
+    struct FluxionJoin* join;    // Input slots (NULL = single input)
+    NodeAction action;           // Business logic
+    NodeJoinAction join_action;  // Fan-in logic on input slots (takes precedence over the others)
+    NodeAsyncAction async_action; // Blocking logic, run off the pulse (takes precedence over the single-input ones)
+    int64_t topo_order;          // Online topological order (0 = never linked)
+
+    /* --- Warm: optional behaviors --- */
+    NodeBatchAction batch_action; // Whole-batch logic (optional)
+    NodeFlowAction flow_action;  // Output-producing logic (optional, takes precedence in dataflow mode)
+    void* state;                 // Persistent node memory
+    struct FluxionCoalesce* coalesce; // Emit coalescing (NULL = every emission propagates)
+    struct FluxionAsyncNode* async;   // Jobs queued or running (NULL = never submitted)
+    struct FluxionProfile* profile;   // Recorded runs (NULL = never profiled)
+
+    /* --- Scheduling --- */
+    uint32_t sched_level;        // Dependency level (parallel), or predecessors left (ordered)
+    uint8_t priority;            // FluxionPriority class
+    uint64_t deadline_ns;        // Budget from the pulse start (0 = none)
+    uint64_t sched_key;          // Urgency inherited from ready successors (ordered)
+
+    /* --- Cold: construction, debugging and memory management --- */
+    uint32_t uid;              // Stable unique identifier
+    const char* name;          // Symbolic name
+    const char* data_type;     // Expected data type (debug)
+    FluxionTypeId type_id;     // Interned data_type (see fluxion_node_type_id())
+    size_t state_size;         // Size of the state (optional)
+    struct FluxionSlab* state_slab; // Allocator owning the state (NULL = malloc)
+    size_t subscriber_capacity; // Allocated subscriber slots
+    uint64_t topo_mark;        // Visit mark of link-time cycle searches
 };
 
 /* ============================================================================
@@ -68,8 +169,52 @@ struct Node {
  */
 void fluxion_node_set_state(Node* n, void* state_data, size_t size);
 
+/**
+ * @brief Overwrites the state in place, without reallocating
+ *
+ * Copies `state_data` over the current state (state_size bytes),
+ * or zero-fills it when `state_data` is NULL.
+ */
+void fluxion_node_reset_state(Node* n, const void* state_data);
+
+/**
+ * @brief Moves the state into a slab; later states are allocated from it
+ *
+ * The slab must outlive the node (or its next fluxion_node_cleanup()).
+ * NULL moves the state back to the system allocator.
+ */
+void fluxion_node_bind_slab(Node* n, struct FluxionSlab* slab);
+
+/**
+ * @brief Ensures the subscriber array can hold `capacity` entries
+ * @return 0 if memory is exhausted
+ */
+int fluxion_node_reserve_subscribers(Node* n, size_t capacity);
+
+/**
+ * @brief Sets the priority class and deadline of a node
+ *
+ * Both only matter to ordered pulses (see fluxion_set_ordering()).
+ * The deadline is a budget in nanoseconds from the start of the
+ * pulse; 0 means none.
+ */
+void fluxion_node_set_priority(Node* n, FluxionPriority priority, uint64_t deadline_ns);
+
+/**
+ * @brief Interned data type of a node
+ *
+ * NODE_INIT() only records the name: the ID is interned on first use
+ * (link, typed emit, join slot, accumulation) and cached in type_id.
+ */
+FluxionTypeId fluxion_node_type_id(Node* n);
+
 /**
  * @brief Removes a link between two nodes
+ *
+ * Subscription order is preserved, so removal is O(degree of src): the
+ * subscribers after `dst` move down by one. The array keeps its
+ * capacity. To remove many edges of high-degree nodes, use
+ * fluxion_builder_unlink() (O(1), does not preserve order).
  */
 void fluxion_node_unlink(Node* src, Node* dst);
 
@@ -104,27 +249,133 @@ static inline int fluxion_node_is_ready(const Node* n) {
  */
 #define FLUX_NODE(name) void name##_logic(Node* self, void* data)
 
+/**
+ * @brief Defines a batch-aware Fluxion logic
+ * Usage:
+ *   FLUX_BATCH_NODE(my_logic) {
+ *       for (size_t i = 0; i < count; i++) { ... }
+ *   }
+ */
+#define FLUX_BATCH_NODE(name) \
+    void name##_batch(Node* self, void* items, size_t count, size_t stride)
+
+/**
+ * @brief Attaches a batch logic to an initialized node
+ */
+#define NODE_SET_BATCH(node_var, logic_func) \
+    ((node_var).batch_action = logic_func##_batch)
+
+/**
+ * @brief Defines a dataflow Fluxion logic, returning its output
+ * Usage:
+ *   FLUX_FLOW_NODE(my_filter) {
+ *       return keep(data) ? data : FLUXION_NO_OUTPUT;
+ *   }
+ */
+#define FLUX_FLOW_NODE(name) void* name##_flow(Node* self, void* data)
+
+/**
+ * @brief Attaches a dataflow logic to an initialized node
+ */
+#define NODE_SET_FLOW(node_var, logic_func) \
+    ((node_var).flow_action = logic_func##_flow)
+
+/**
+ * @brief Defines a join logic, called with the node's input slots
+ * Usage:
+ *   FLUX_JOIN_NODE(my_join) {
+ *       const float* a = slots[0];
+ *       const float* b = slots[1];
+ *       ...
+ *       return FLUXION_NO_OUTPUT;
+ *   }
+ */
+#define FLUX_JOIN_NODE(name) \
+    void* name##_join(Node* self, void* const slots[], uint32_t fresh)
+
+/**
+ * @brief Defines an async logic, run on an I/O worker thread
+ * Usage:
+ *   FLUX_ASYNC_NODE(my_writer) {
+ *       fwrite(data, 1, size, file);
+ *       return data;  // or FLUXION_NO_OUTPUT
+ *   }
+ */
+#define FLUX_ASYNC_NODE(name) void* name##_async(Node* self, void* data)
+
 /**
  * @brief Generates a pseudo-unique UID at compile time
  */
 #define FLUXION_UID(var) ((uint32_t)((uintptr_t)&(var) ^ __LINE__))
 
 /**
- * @brief Initializes a Fluxion node
+ * @brief Node with every field initialized (see NODE_INIT)
  */
-#define NODE_INIT(node_var, logic_func, type_str) \
-    node_var = (Node){ \
+#define FLUXION_NODE_LITERAL(node_var, action_func, type_str) \
+    (Node){ \
+        .last_pulse_id = 0, \
+        .state_flag = FLUXION_NODE_SLEEPING, \
+        .input_buffer = NULL, \
+        .input_count = 0, \
+        .input_stride = 0, \
+        .input_origin = NULL, \
+        .input_writer = INT64_MIN, \
+        .ready_next = NULL, \
+        .subscribers = NULL, \
+        .edge_transfers = NULL, \
+        .subscriber_count = 0, \
+        .join = NULL, \
+        .action = action_func, \
+        .join_action = NULL, \
+        .async_action = NULL, \
+        .topo_order = 0, \
+        .batch_action = NULL, \
+        .flow_action = NULL, \
+        .state = NULL, \
+        .coalesce = NULL, \
+        .async = NULL, \
+        .profile = NULL, \
+        .sched_level = 0, \
+        .priority = FLUXION_PRIORITY_NORMAL, \
+        .deadline_ns = 0, \
+        .sched_key = 0, \
         .uid = FLUXION_UID(node_var), \
         .name = #node_var, \
         .data_type = type_str, \
-        .action = logic_func##_logic, \
-        .state = NULL, \
+        .type_id = FLUXION_TYPE_NONE, \
         .state_size = 0, \
-        .input_buffer = NULL, \
-        .state_flag = FLUXION_NODE_SLEEPING, \
-        .last_pulse_id = 0, \
-        .subscribers = NULL, \
-        .subscriber_count = 0 \
+        .state_slab = NULL, \
+        .subscriber_capacity = 0, \
+        .topo_mark = 0 \
     }
 
+/**
+ * @brief Initializes a Fluxion node
+ */
+#define NODE_INIT(node_var, logic_func, type_str) \
+    node_var = FLUXION_NODE_LITERAL(node_var, logic_func##_logic, type_str)
+
+/**
+ * @brief Initializes a dataflow node (logic defined with FLUX_FLOW_NODE)
+ */
+#define FLOW_NODE_INIT(node_var, logic_func, type_str) \
+    (node_var = FLUXION_NODE_LITERAL(node_var, NULL, type_str), \
+     (node_var).flow_action = logic_func##_flow)
+
+/**
+ * @brief Initializes a join node (logic defined with FLUX_JOIN_NODE)
+ *
+ * Slots are set up afterwards with fluxion_join_configure().
+ */
+#define JOIN_NODE_INIT(node_var, logic_func, type_str) \
+    (node_var = FLUXION_NODE_LITERAL(node_var, NULL, type_str), \
+     (node_var).join_action = logic_func##_join)
+
+/**
+ * @brief Initializes an async node (logic defined with FLUX_ASYNC_NODE)
+ */
+#define ASYNC_NODE_INIT(node_var, logic_func, type_str) \
+    (node_var = FLUXION_NODE_LITERAL(node_var, NULL, type_str), \
+     (node_var).async_action = logic_func##_async)
+
 #endif /* FLUXION_NODE_H */
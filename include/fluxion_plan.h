@@ -0,0 +1,107 @@
+#ifndef FLUXION_PLAN_H
+#define FLUXION_PLAN_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "fluxion_node.h"
+
+/* ============================================================================
+ * FLUXION — COMPILED EXECUTION PLAN
+ *
+ * A plan freezes a graph into an immutable, cache-friendly layout:
+ * - Nodes are stored in topological order
+ * - Adjacency is stored as compressed sparse rows (CSR) of 32-bit indices
+ * - Pulses walk the plan linearly instead of chasing subscriber pointers
+ *
+ * The adjacency is a snapshot: any link or unlink made after compiling
+ * (fluxion_topology_version() changed) makes the plan stale, and the
+ * runtime stops using it until it is compiled again.
+ * ============================================================================
+ */
+
+#define FLUXION_PLAN_NONE UINT32_MAX
+
+/**
+ * @brief Immutable execution plan of a graph
+ *
+ * The successors of nodes[i] are the plan indices
+ * edge_targets[edge_offsets[i] .. edge_offsets[i + 1]).
+ *
+ * The plan maps nodes back to their index itself (open addressing on
+ * the node address), so several plans and streams may share nodes.
+ */
+typedef struct {
+    Node** nodes;              // Nodes in topological order
+    uint32_t node_count;
+
+    uint32_t* edge_offsets;    // CSR row offsets (node_count + 1 entries)
+    uint32_t* edge_targets;    // CSR column indices into nodes[]
+    uint32_t edge_count;
+
+    const Node** index_keys;   // Node -> index map (NULL = free slot)
+    uint32_t* index_values;
+    uint32_t index_mask;       // Slot count - 1 (power of two)
+
+    uint64_t topology_version; // fluxion_topology_version() when compiled
+} FluxionPlan;
+
+/* ============================================================================
+ * PLAN API
+ * ============================================================================
+ */
+
+/**
+ * @brief Compiles a graph into an execution plan
+ *
+ * NULL entries and duplicates in graph[] are ignored.
+ * Every subscriber of a node must itself be part of graph[].
+ * The nodes are not modified: a node may belong to several plans.
+ *
+ * @return A new plan, or NULL if the graph is cyclic, not closed
+ *         under its subscribers, or memory is exhausted
+ */
+FluxionPlan* fluxion_plan_compile(Node* graph[], size_t count);
+
+/**
+ * @brief Checks that no edge changed since the plan was compiled
+ *
+ * The topology version is process-wide: links and unlinks in other
+ * graphs also make the plan stale.
+ */
+int fluxion_plan_is_current(const FluxionPlan* plan);
+
+/**
+ * @brief Frees a plan (the nodes themselves are untouched)
+ */
+void fluxion_plan_destroy(FluxionPlan* plan);
+
+/**
+ * @brief Slot of a node address in an index map of `mask + 1` slots
+ */
+static inline uint32_t fluxion_plan_hash(const Node* n, uint32_t mask) {
+    return (uint32_t)(((uint64_t)(uintptr_t)n * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+}
+
+/**
+ * @brief Position of a node in the plan
+ * @return Its index in nodes[], or FLUXION_PLAN_NONE if it is not part of the plan
+ */
+static inline uint32_t fluxion_plan_index(const FluxionPlan* plan, const Node* n) {
+    if (!plan || !n) return FLUXION_PLAN_NONE;
+
+    for (uint32_t slot = fluxion_plan_hash(n, plan->index_mask);; slot = (slot + 1) & plan->index_mask) {
+        const Node* key = plan->index_keys[slot];
+        if (key == n) return plan->index_values[slot];
+        if (!key) return FLUXION_PLAN_NONE;
+    }
+}
+
+/**
+ * @brief Checks whether a node belongs to the plan
+ */
+static inline int fluxion_plan_contains(const FluxionPlan* plan, const Node* n) {
+    return fluxion_plan_index(plan, n) != FLUXION_PLAN_NONE;
+}
+
+#endif /* FLUXION_PLAN_H */
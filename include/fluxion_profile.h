@@ -0,0 +1,108 @@
+#ifndef FLUXION_PROFILE_H
+#define FLUXION_PROFILE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "fluxion_node.h"
+#include "fluxion_runtime.h"
+
+/* ============================================================================
+ * FLUXION — NODE PROFILES
+ *
+ * While profiling is on, every executed action is recorded in its
+ * node's profile: run count, time spent, and two log-linear histograms
+ * (FLUXION_LATENCY_BUCKETS buckets, percentiles within 25%):
+ * - latency: duration of the action
+ * - wait: time from the node's activation to the start of its action
+ *   (for async nodes, from submission to the start of the job)
+ *
+ * A profile is allocated by the node's first recorded run and has a
+ * fixed size. It is only written by the thread running the node, so
+ * recording takes no lock; read profiles between pulses. Times are
+ * recorded in timestamp-counter ticks and converted when read.
+ * ============================================================================
+ */
+
+#define FLUXION_PROFILE_TOP 5    // Hottest nodes kept by fluxion_inspect_profiles()
+
+/**
+ * @brief Summary of a node's profile (nanoseconds)
+ */
+typedef struct {
+    const Node* node;
+    uint64_t runs;                // Executed actions
+    uint64_t total_ns;            // Time spent in the action
+    uint64_t p50_ns;
+    uint64_t p99_ns;
+    uint64_t p999_ns;
+    uint64_t max_ns;
+    uint64_t wait_p50_ns;         // Activation to start of the action
+    uint64_t wait_p99_ns;
+    uint64_t wait_max_ns;
+    uint64_t transfers;           // Inputs handed to its subscribers
+} FluxionProfileStats;
+
+/* ============================================================================
+ * PROFILING API
+ * ============================================================================
+ */
+
+/**
+ * @brief Starts (or stops) profiling the nodes run by a context
+ *
+ * Profiling adds two timestamp reads per executed action and one per
+ * activation. Stopping keeps the nodes' profiles, which are freed
+ * with the nodes.
+ */
+FluxionError fluxion_enable_profiling(FluxionContext* ctx, int enabled);
+
+/**
+ * @brief Summarizes a node's profile (zero if never profiled)
+ */
+FluxionProfileStats fluxion_node_profile(const Node* n);
+
+/**
+ * @brief Action latency below which a fraction `q` of the runs finished
+ * @return Nanoseconds (upper bound of the histogram bucket)
+ */
+uint64_t fluxion_node_percentile(const Node* n, double q);
+
+/**
+ * @brief Clears the profile of a node
+ */
+void fluxion_reset_profile(Node* n);
+
+/**
+ * @brief Profiles of the nodes that spent the most time in their action
+ * @param out Receives at most `max` summaries, hottest first
+ * @return Number of summaries written
+ */
+size_t fluxion_hottest_nodes(
+    Node* graph[],
+    size_t count,
+    FluxionProfileStats out[],
+    size_t max
+);
+
+/**
+ * @brief Notes the activation of a node (runtime hook)
+ */
+void fluxion_profile_ready(Node* n);
+
+/**
+ * @brief Records an executed action, in ticks (runtime hook)
+ */
+void fluxion_profile_run(Node* n, uint64_t begin, uint64_t end);
+
+/**
+ * @brief Records an async job, in ticks (runtime hook)
+ */
+void fluxion_profile_job(Node* n, uint64_t submitted, uint64_t begin, uint64_t end);
+
+/**
+ * @brief Frees the profile of a node (node cleanup hook)
+ */
+void fluxion_profile_node_destroy(Node* n);
+
+#endif /* FLUXION_PROFILE_H */
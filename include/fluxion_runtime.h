@@ -5,6 +5,8 @@
 #include <stddef.h>
 
 #include "fluxion_node.h"
+#include "fluxion_plan.h"
+#include "fluxion_memory.h"
 
 /* ============================================================================
  * FLUXION — RUNTIME CORE
@@ -23,18 +25,56 @@ typedef enum {
     FLUXION_ERR_NULL_CONTEXT,
     FLUXION_ERR_INVALID_NODE,
     FLUXION_ERR_CYCLE_DETECTED,
-    FLUXION_ERR_TYPE_MISMATCH
+    FLUXION_ERR_TYPE_MISMATCH,
+    FLUXION_ERR_OUT_OF_MEMORY,
+    FLUXION_ERR_INVALID_ARGUMENT,
+    FLUXION_ERR_QUEUE_FULL,
+    FLUXION_ERR_QUEUE_CLOSED,
+    FLUXION_ERR_SHED
 } FluxionError;
 
 /* --- EXECUTION POLICY --- */
 
 typedef enum {
     FLUXION_EXEC_IMMEDIATE = 0,  // Execute immediately upon emission
-    FLUXION_EXEC_DEFERRED        // Execute during fluxion_pulse()
+    FLUXION_EXEC_DEFERRED,       // Execute during fluxion_pulse()
+    FLUXION_EXEC_PARALLEL,       // Execute during fluxion_pulse() on the worker pool
+    FLUXION_EXEC_DATAFLOW        // Execute during fluxion_pulse(), waking only subscribers of nodes with output
 } FluxionExecPolicy;
 
+/* --- SCHEDULING --- */
+
+typedef enum {
+    FLUXION_SCHED_READY_QUEUE = 0, // Visit only nodes activated by propagation
+    FLUXION_SCHED_FULL_SCAN        // Scan every node passed to the pulse
+} FluxionScheduling;
+
+/* --- ORDERING WITHIN A PULSE --- */
+
+typedef enum {
+    FLUXION_ORDER_TOPOLOGICAL = 0, // Ready-queue order (default)
+    FLUXION_ORDER_PRIORITY,        // Highest priority class first, then earliest deadline
+    FLUXION_ORDER_DEADLINE         // Earliest deadline first, then highest priority class
+} FluxionOrdering;
+
+/* --- WAIT STRATEGY (THREADS OF INGESTION AND STREAMING) --- */
+
+typedef enum {
+    FLUXION_WAIT_SPIN = 0,  // Busy-wait (lowest latency, burns a core)
+    FLUXION_WAIT_YIELD,     // Spin, then yield the CPU between attempts
+    FLUXION_WAIT_PARK       // Spin, yield, then sleep until woken
+} FluxionWaitPolicy;
+
 /* --- RUNTIME CONTEXT --- */
 
+struct FluxionWorkItem; // Propagation frame (internal)
+struct FluxionPool;     // Work-stealing worker pool (internal)
+struct FluxionClassStats; // Per-priority-class latency (see fluxion_sched.h)
+struct FluxionAsync;      // I/O workers of async nodes (see fluxion_async.h)
+struct FluxionLog;        // Binary pulse log (see fluxion_log.h)
+struct FluxionTracer;     // Execution trace (see fluxion_trace.h)
+struct FluxionShm;        // Shared stats segment (see fluxion_shm.h)
+
 /**
  * @brief Global Fluxion context
  *
@@ -46,6 +86,83 @@ typedef struct {
     uint64_t executed_nodes;      // Execution statistics
     FluxionError last_error;      // Last encountered error
     FluxionExecPolicy policy;     // Execution policy
+    FluxionScheduling scheduling; // How a pulse finds ready nodes
+    const FluxionPlan* plan;      // Compiled plan used for propagation (optional)
+    int type_checks;              // Check fluxion_emit_typed() payloads
+
+    /* --- Propagation worklist (reused across emissions) --- */
+    struct FluxionWorkItem* worklist;
+    size_t worklist_capacity;
+
+    /* --- Ready queue (intrusive, topologically ordered) --- */
+    Node* ready_head;
+    size_t ready_count;
+
+    /* --- Plan ready list (nodes reached through a plan, in post-order) --- */
+    Node** ready_list;            // Newer than every queued node
+    size_t ready_list_count;
+    size_t ready_list_capacity;
+    const FluxionPlan* ready_list_plan; // Plan that reached them
+    Node** ready_spare;           // Swapped in while a list runs
+    size_t ready_spare_capacity;
+
+    /* --- Parallel execution --- */
+    struct FluxionPool* pool;     // Workers (NULL = caller thread only)
+    int deterministic;            // Run the level schedule serially
+    Node** schedule;              // Ready nodes, then the same nodes sorted by level
+    size_t schedule_capacity;
+    uint32_t* levels;             // Level boundaries in the sorted schedule
+    size_t levels_capacity;
+
+    /* --- Ordered execution (list schedule in `schedule`) --- */
+    FluxionOrdering ordering;
+    uint64_t pulse_start_ns;      // Start of the running pulse (class statistics only)
+    struct FluxionClassStats* class_stats; // NULL = not collected
+
+    /* --- Async nodes (started by the first submission) --- */
+    struct FluxionAsync* async;
+
+    /* --- Emit coalescing (held emissions, flushed when a pulse starts) --- */
+    Node* coalesce_head;
+    Node* coalesce_tail;
+    int coalesce_flushing;
+
+    /* --- Dataflow (min-heap on topo_order) --- */
+    Node** flow_heap;
+    size_t flow_count;
+    size_t flow_capacity;
+
+    /* --- Incremental metrics (read in O(1) by fluxion_inspect()) --- */
+    uint64_t activated_nodes;     // Transitions to READY
+    uint64_t edge_transfers;      // Inputs handed along an edge
+    size_t running_nodes;         // Nodes executing (0 between pulses)
+    uint64_t pulse_ready;         // Nodes made ready for the last pulse
+    uint64_t pulse_executed;      // Actions executed by the last pulse
+    uint64_t activated_mark;      // activated_nodes when the last pulse ended
+
+    /* --- Pulse log (NULL = not logging) --- */
+    struct FluxionLog* log;
+
+    /* --- Execution trace (NULL = not tracing) --- */
+    struct FluxionTracer* tracer;
+
+    /* --- Node profiles (see fluxion_profile.h) --- */
+    int profiling;
+
+    /* --- Shared stats segment (NULL = not published) --- */
+    struct FluxionShm* shm;
+
+    /* --- Cycle count of the last inspected graph --- */
+    Node* const* cycle_graph;
+    size_t cycle_graph_count;
+    uint64_t cycle_version;       // Topology version of the count (0 = none)
+    size_t cycle_count;
+
+    /* --- Messages --- */
+    FluxionArena arena;           // Pulse arena, reset when a pulse ends
+
+    /* --- Node state --- */
+    FluxionSlab state_slab;       // Size-class allocator for bound node states
 } FluxionContext;
 
 /* ============================================================================
@@ -58,20 +175,103 @@ typedef struct {
  */
 FluxionContext fluxion_init(void);
 
+/**
+ * @brief Releases the resources owned by a context
+ *
+ * The graph itself is untouched. The context may be reused
+ * after a new fluxion_init().
+ */
+void fluxion_cleanup(FluxionContext* ctx);
+
 /**
  * @brief Sets the execution policy
  */
 void fluxion_set_policy(FluxionContext* ctx, FluxionExecPolicy policy);
 
+/**
+ * @brief Name of an execution policy ("DEFERRED", "DATAFLOW"...)
+ */
+const char* fluxion_policy_name(FluxionExecPolicy policy);
+
+/**
+ * @brief Sizes the worker pool used by FLUXION_EXEC_PARALLEL
+ *
+ * The calling thread counts as one worker: `workers - 1` threads are
+ * started. 0 or 1 stops the pool and runs every node on the caller.
+ */
+FluxionError fluxion_set_workers(FluxionContext* ctx, unsigned workers);
+
+/**
+ * @brief Enables deterministic parallel execution (for tests)
+ *
+ * The level schedule is still computed, but its levels run serially
+ * on the calling thread, in topological order.
+ */
+void fluxion_set_deterministic(FluxionContext* ctx, int enabled);
+
+/**
+ * @brief Selects how pulses find ready nodes
+ *
+ * FLUXION_SCHED_READY_QUEUE (default): a pulse costs O(ready) and runs
+ * every node activated since the previous pulse, in topological order.
+ * FLUXION_SCHED_FULL_SCAN: a pulse checks every node it is given.
+ */
+void fluxion_set_scheduling(FluxionContext* ctx, FluxionScheduling scheduling);
+
+/**
+ * @brief Selects the order in which a pulse runs its ready nodes
+ *
+ * FLUXION_ORDER_PRIORITY and FLUXION_ORDER_DEADLINE replace the plain
+ * ready-queue walk with a list schedule: among the nodes whose ready
+ * predecessors have all run, the most urgent runs next. A node
+ * inherits the urgency of its most urgent ready successor, so the
+ * path leading to a critical node is not delayed behind bulk work.
+ * Applies to serial ready-queue pulses (IMMEDIATE, DEFERRED); the
+ * parallel, dataflow and full-scan modes keep their own order.
+ */
+void fluxion_set_ordering(FluxionContext* ctx, FluxionOrdering ordering);
+
+/**
+ * @brief Enables emit-time type checks (see fluxion_emit_typed())
+ */
+void fluxion_set_type_checking(FluxionContext* ctx, int enabled);
+
+/**
+ * @brief Binds a compiled plan to the context
+ *
+ * Emissions targeting nodes of the plan propagate through its
+ * CSR adjacency. Pass NULL to return to pointer-based propagation.
+ * The plan must outlive its binding.
+ *
+ * Linking or unlinking afterwards makes the plan stale (see
+ * fluxion_plan_is_current()): the next emission unbinds it with a
+ * warning and propagates through subscriber pointers. Compile and bind
+ * a new plan after editing the graph.
+ *
+ * @return FLUXION_ERR_INVALID_ARGUMENT if the plan is already stale (not bound)
+ */
+FluxionError fluxion_set_plan(FluxionContext* ctx, const FluxionPlan* plan);
+
 /**
  * @brief Links two nodes in the graph
  *
- * May reject the connection if:
- * - Types are incompatible
- * - An immediate cycle is detected
+ * Warns if types are incompatible. Rejects the connection with
+ * FLUXION_ERR_CYCLE_DETECTED if it would close a cycle (checked
+ * incrementally against the nodes' online topological order).
  */
 FluxionError fluxion_link(Node* src, Node* dst);
 
+/**
+ * @brief Links a node to a given input slot of a join node
+ *
+ * fluxion_link() binds edges into a join to its free slots in link
+ * order; this variant picks the slot explicitly (see fluxion_join.h).
+ *
+ * @return FLUXION_ERR_TYPE_MISMATCH if src's type does not fit the slot,
+ *         FLUXION_ERR_INVALID_ARGUMENT if dst is not a join or `slot` is out of range
+ */
+FluxionError fluxion_link_slot(Node* src, Node* dst, uint32_t slot);
+
 /**
  * @brief Injects data into the graph
  *
@@ -80,16 +280,171 @@ FluxionError fluxion_link(Node* src, Node* dst);
  */
 FluxionError fluxion_emit(FluxionContext* ctx, Node* target, void* data);
 
+/**
+ * @brief Injects data of a known type into the graph
+ *
+ * When type checking is enabled, data whose type differs from the
+ * target's is rejected with FLUXION_ERR_TYPE_MISMATCH (an integer
+ * compare). Otherwise, behaves like fluxion_emit().
+ */
+FluxionError fluxion_emit_typed(
+    FluxionContext* ctx,
+    Node* target,
+    void* data,
+    FluxionTypeId type
+);
+
+/**
+ * @brief Injects a copy of a value, sized by the target's registered type
+ *
+ * The value is copied into a pulse-arena message, so it may live on
+ * the caller's stack.
+ *
+ * @return FLUXION_ERR_INVALID_ARGUMENT if the target's type has no known size
+ */
+FluxionError fluxion_emit_copy(FluxionContext* ctx, Node* target, const void* value);
+
+/**
+ * @brief Injects a batch of payloads into the graph, as a single pulse
+ *
+ * Every reached node receives the whole batch: its batch_action runs
+ * once on the span, or its action runs once per item.
+ *
+ * @param items First item (must stay valid until the pulse has run)
+ * @param count Number of items (0 emits nothing)
+ * @param stride Distance in bytes between two items (0 = size of the target's
+ *               registered type; may also be 0 for a single item)
+ */
+FluxionError fluxion_emit_batch(
+    FluxionContext* ctx,
+    Node* target,
+    void* items,
+    size_t count,
+    size_t stride
+);
+
+/**
+ * @brief Injects data into one input slot of a join node
+ *
+ * Joins take emissions only through a slot: the other emit functions
+ * reject them with FLUXION_ERR_INVALID_ARGUMENT.
+ */
+FluxionError fluxion_emit_slot(FluxionContext* ctx, Node* join, uint32_t slot, void* data);
+
+/* ============================================================================
+ * MESSAGES (PULSE ARENA)
+ * ============================================================================
+ */
+
+/**
+ * @brief Allocates a message payload from the pulse arena
+ *
+ * Emitting a message transfers the caller's reference to the graph:
+ * it is shared by every reached node without copies, and all messages
+ * are freed in bulk when the next pulse ends. Nodes must not keep
+ * message pointers across pulses.
+ *
+ * @return NULL if memory is exhausted
+ */
+void* fluxion_msg_alloc(FluxionContext* ctx, size_t size);
+
+/**
+ * @brief Returns a writable version of the node's input (copy-on-write)
+ *
+ * Call from an action with the `data` it received. A message still
+ * read by other nodes is copied first; the copy replaces the node's
+ * input and is handed to its subscribers when the action returns.
+ * When several parents of a node rewrite the same emission, the node
+ * receives the rewrite of the parent latest in topological order, in
+ * every policy. Raw (non-message) payloads are returned unchanged.
+ *
+ * @return Writable payload, or NULL if the copy could not be allocated
+ */
+void* fluxion_msg_write(Node* self, void* data);
+
+/* ============================================================================
+ * NODE STATE (SLAB)
+ * ============================================================================
+ */
+
+/**
+ * @brief Packs the states of a plan's nodes into the context slab
+ *
+ * States are copied into one contiguous region, in topological order,
+ * so that a pulse walks them sequentially. Every node of the plan is
+ * bound to the slab: later fluxion_node_set_state() calls reuse its
+ * size classes instead of the system allocator. States larger than
+ * the biggest class stay individually allocated.
+ *
+ * The context must not move afterwards, and bound nodes must be
+ * cleaned up before fluxion_cleanup().
+ */
+FluxionError fluxion_pack_state(FluxionContext* ctx, const FluxionPlan* plan);
+
 /**
  * @brief Executes all nodes ready for the current pulse
+ *
+ * With ready-queue scheduling, graph may be NULL: only the
+ * queued nodes are visited. With full-scan scheduling, only the
+ * nodes of graph[] are considered, in array order, and a NULL graph
+ * makes the call a no-op. Ready nodes left out stay ready, but their
+ * pulse-arena message is recycled: they run on a NULL input unless
+ * activated again.
+ *
+ * With FLUXION_EXEC_PARALLEL (ready-queue scheduling only), ready
+ * nodes are grouped by dependency level: nodes of a level never
+ * depend on each other and run concurrently, levels run in order.
+ * Actions must not emit into the context from worker threads.
+ *
+ * With FLUXION_EXEC_DATAFLOW, emissions only activate their target.
+ * The pulse runs ready nodes by increasing topo_order (graph[] is not
+ * needed) and activates the subscribers of a node only when it has an
+ * output: the value returned by its flow_action, or its input for
+ * nodes with a plain action. A FLUXION_NO_OUTPUT result prunes the
+ * whole branch for this pulse. Orders come from fluxion_link(), so
+ * subscriber arrays must not be edited by hand.
+ *
+ * Returning a pulse-arena message hands one reference to the runtime:
+ * the node's own input reference when it forwards its input, the
+ * creator's for a new message. Batches pass or stop as a whole: the
+ * flow_action runs per item, and the batch moves on if any item
+ * produced an output.
+ *
+ * A pulse starts by propagating the emissions held by coalescing
+ * sources whose window allows it (see fluxion_coalesce.h).
  */
 void fluxion_pulse(FluxionContext* ctx, Node* graph[], size_t count);
 
+/**
+ * @brief Executes all ready nodes of a plan, in topological order
+ *
+ * Runs the ready nodes on the calling thread, whatever the policy
+ * (except FLUXION_EXEC_DATAFLOW, which runs as in fluxion_pulse()).
+ * With ready-queue scheduling, only the nodes the plan's emissions
+ * reached are visited, newest emission first: O(ready), not O(plan).
+ * Full-scan scheduling walks plan->nodes linearly. Ready nodes outside the plan do not
+ * run: they stay queued for the next fluxion_pulse(), without their
+ * pulse-arena message.
+ *
+ * A stale plan (see fluxion_plan_is_current()) is not walked: the
+ * pulse runs the ready queue as fluxion_pulse(ctx, NULL, 0) would, and
+ * sets last_error to FLUXION_ERR_INVALID_ARGUMENT.
+ */
+void fluxion_pulse_plan(FluxionContext* ctx, const FluxionPlan* plan);
+
 /**
  * @brief Resets the runtime state (without destroying the graph)
+ *
+ * Emissions held by coalescing sources are discarded, and the
+ * context's metrics counters restart (per-edge counts are kept).
  */
 void fluxion_reset(FluxionContext* ctx);
 
+/**
+ * @brief Monotonic clock, in nanoseconds
+ */
+uint64_t fluxion_time_ns(void);
+
 /* ============================================================================
  * DSL MACROS (ERGONOMICS)
  * ============================================================================
@@ -0,0 +1,75 @@
+#ifndef FLUXION_SCHED_H
+#define FLUXION_SCHED_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "fluxion_node.h"
+#include "fluxion_runtime.h"
+
+/* ============================================================================
+ * FLUXION — PRIORITY CLASSES
+ *
+ * Nodes carry a priority class and an optional deadline (see
+ * fluxion_node_set_priority()); fluxion_set_ordering() makes pulses
+ * run the most urgent ready nodes first.
+ *
+ * Class statistics measure the effect: for every node run by a serial
+ * pulse, the time from the start of the pulse to the end of its action
+ * is recorded under the node's class, in a log-scale histogram (four
+ * buckets per power of two: percentiles are within 25%).
+ * ============================================================================
+ */
+
+#define FLUXION_LATENCY_BUCKETS 256
+
+/**
+ * @brief Latency of the nodes of one priority class
+ */
+typedef struct FluxionClassStats {
+    uint64_t runs;                  // Nodes run
+    uint64_t total_ns;              // Sum of latencies
+    uint64_t max_ns;
+    uint64_t deadline_misses;       // Nodes that finished past their deadline
+    uint64_t buckets[FLUXION_LATENCY_BUCKETS];
+} FluxionClassStats;
+
+/* ============================================================================
+ * CLASS STATISTICS API
+ * ============================================================================
+ */
+
+/**
+ * @brief Starts (or stops and frees) the collection of class statistics
+ *
+ * Collection adds a clock read per node run.
+ */
+FluxionError fluxion_enable_class_stats(FluxionContext* ctx, int enabled);
+
+/**
+ * @brief Reads the statistics of a class (zero if not collected)
+ */
+FluxionClassStats fluxion_class_stats(const FluxionContext* ctx, FluxionPriority priority);
+
+/**
+ * @brief Clears the statistics of every class
+ */
+void fluxion_reset_class_stats(FluxionContext* ctx);
+
+/**
+ * @brief Latency below which a fraction `q` of the runs finished
+ * @return Upper bound of the histogram bucket, in nanoseconds
+ */
+uint64_t fluxion_class_percentile(const FluxionClassStats* stats, double q);
+
+/**
+ * @brief Name of a priority class ("CRITICAL", "BULK"...)
+ */
+const char* fluxion_priority_name(FluxionPriority priority);
+
+/**
+ * @brief Records the latency of a node run (runtime hook)
+ */
+void fluxion_class_record(FluxionContext* ctx, const Node* n, uint64_t latency_ns);
+
+#endif /* FLUXION_SCHED_H */
@@ -0,0 +1,131 @@
+#ifndef FLUXION_SHM_H
+#define FLUXION_SHM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "fluxion_node.h"
+#include "fluxion_runtime.h"
+
+/* ============================================================================
+ * FLUXION — SHARED STATS
+ *
+ * A context can publish its counters and the state of a graph's nodes
+ * to a POSIX shared-memory segment, for monitors running in another
+ * process (tools/fluxion_top.c). The runtime republishes at the end of
+ * a pulse, at most every FLUXION_SHM_PERIOD_MS: the process being
+ * monitored never forks, prints or waits for its readers.
+ *
+ * The segment is a seqlock: the writer makes `seq` odd, copies the
+ * snapshot, then makes it even again. Readers copy the segment and
+ * retry when `seq` was odd or changed meanwhile, so they never block
+ * the writer. Layout (host byte order): one FluxionShmHeader, then
+ * `capacity` FluxionShmNode entries.
+ * ============================================================================
+ */
+
+#define FLUXION_SHM_MAGIC     "FLUXSHM"
+#define FLUXION_SHM_VERSION   1
+#define FLUXION_SHM_NAME_LEN  32     // Node name bytes kept (truncated, NUL-terminated)
+#define FLUXION_SHM_PERIOD_MS 100    // Shortest time between two publications
+
+typedef struct FluxionShm FluxionShm;
+
+/**
+ * @brief First bytes of a stats segment
+ */
+typedef struct {
+    char magic[8];                // FLUXION_SHM_MAGIC
+    uint32_t version;             // FLUXION_SHM_VERSION
+    uint32_t node_size;           // sizeof(FluxionShmNode)
+    uint64_t seq;                 // Odd while a snapshot is being written
+    int64_t pid;                  // Publishing process
+    uint32_t live;                // 0 once the publisher has stopped
+    uint32_t capacity;            // Node entries after the header
+    uint32_t node_count;          // Entries of the snapshot
+    uint32_t policy;              // FluxionExecPolicy
+    uint64_t published_ns;        // fluxion_time_ns() of the snapshot
+    uint64_t pulse_id;            // Next pulse of the context
+    uint64_t executed_nodes;      // Actions executed since the context started
+    uint64_t total_transfers;     // Inputs handed along edges
+    uint64_t pulse_ready;         // Nodes made ready for the last pulse
+    uint64_t pulse_executed;      // Actions executed by the last pulse
+    int64_t last_error;           // FluxionError after the last pulse
+} FluxionShmHeader;
+
+/**
+ * @brief One node of the snapshot
+ */
+typedef struct {
+    char name[FLUXION_SHM_NAME_LEN];
+    uint32_t state;               // FluxionNodeState
+    uint32_t subscribers;
+    uint64_t transfers;           // Inputs handed to its subscribers
+    uint64_t runs;                // Profiled runs (0 when not profiling)
+    uint64_t total_ns;            // Profiled time spent in the action
+    uint64_t p50_ns;
+    uint64_t p99_ns;
+    uint64_t max_ns;
+} FluxionShmNode;
+
+/* ============================================================================
+ * PUBLISHER API
+ * ============================================================================
+ */
+
+/**
+ * @brief Publishes the context's stats and the nodes of `graph` to a segment
+ *
+ * Creates the segment `name` ("/name" under /dev/shm on Linux) and
+ * writes a first snapshot. The graph array is kept: it must outlive
+ * the publication. Calling again replaces the previous segment. A
+ * segment left by a publisher that stopped or died is replaced; one
+ * whose publisher is still running is not. Per-node latency needs
+ * fluxion_enable_profiling().
+ *
+ * @return FLUXION_ERR_INVALID_ARGUMENT if the segment cannot be created
+ *         or another running publisher owns it
+ */
+FluxionError fluxion_publish_stats(FluxionContext* ctx, const char* name, Node* graph[], size_t count);
+
+/**
+ * @brief Marks the segment stopped and removes it
+ */
+void fluxion_stop_publishing(FluxionContext* ctx);
+
+/**
+ * @brief Republishes if FLUXION_SHM_PERIOD_MS elapsed (runtime hook)
+ */
+void fluxion_shm_pulse(FluxionContext* ctx);
+
+/**
+ * @brief Removes a segment (runtime hook)
+ */
+void fluxion_shm_destroy(FluxionShm* shm);
+
+/* ============================================================================
+ * READER API
+ * ============================================================================
+ */
+
+typedef struct FluxionShmReader FluxionShmReader;
+
+/**
+ * @brief Attaches read-only to the segment `name`
+ * @return NULL if there is no such segment, or not a compatible one
+ */
+FluxionShmReader* fluxion_shm_attach(const char* name);
+
+/**
+ * @brief Copies a consistent snapshot of the segment
+ * @param nodes Receives at most `max` nodes
+ * @return Nodes copied, or -1 if the writer kept the segment busy
+ */
+int fluxion_shm_snapshot(FluxionShmReader* r, FluxionShmHeader* header, FluxionShmNode nodes[], size_t max);
+
+/**
+ * @brief Detaches from the segment
+ */
+void fluxion_shm_detach(FluxionShmReader* r);
+
+#endif /* FLUXION_SHM_H */
@@ -0,0 +1,110 @@
+#ifndef FLUXION_STREAM_H
+#define FLUXION_STREAM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "fluxion_node.h"
+#include "fluxion_runtime.h"
+
+/* ============================================================================
+ * FLUXION — STREAMING EXECUTION
+ *
+ * Pipelined alternative to fluxion_pulse(): every node of the graph is a
+ * stage running on its own thread, and every edge a bounded single-
+ * producer single-consumer queue. Each pulse flows through the graph as
+ * one token per edge (active, or skip for nodes it does not reach), so
+ * upstream stages work on pulse N+1 while downstream ones finish pulse N.
+ *
+ * The Fluxion rules still hold: a reached node runs once per pulse,
+ * after every predecessor of the pulse, and pulses reach a node in the
+ * order they were submitted. A full queue blocks its producer: a slow
+ * stage throttles its predecessors, up to fluxion_stream_pulse().
+ * As in FLUXION_EXEC_DATAFLOW, a node whose flow_action returns
+ * FLUXION_NO_OUTPUT sends skip tokens: its branch sleeps this pulse.
+ * An async node's action runs inline on its stage, like a flow_action.
+ * ============================================================================
+ */
+
+/**
+ * @brief Streaming settings
+ */
+typedef struct {
+    size_t queue_capacity;    // Pulses buffered per edge (rounded up to a power of two)
+    FluxionWaitPolicy wait;   // How a stage waits for input or room
+    unsigned spin_limit;      // Attempts before yielding
+    unsigned yield_limit;     // Yields before parking (FLUXION_WAIT_PARK)
+} FluxionStreamConfig;
+
+typedef struct FluxionStream FluxionStream;
+
+/**
+ * @brief Streaming statistics (approximate while pulses are in flight)
+ */
+typedef struct {
+    uint64_t pulses;          // Pulses submitted
+    uint64_t completed;       // Pulses every stage has processed
+    uint64_t executed;        // Actions run
+    uint64_t stalls;          // Pushes that found a queue full (backpressure)
+} FluxionStreamStats;
+
+/* ============================================================================
+ * STREAM API
+ * ============================================================================
+ */
+
+/**
+ * @brief Default settings: 64 pulses per edge, FLUXION_WAIT_PARK
+ */
+FluxionStreamConfig fluxion_stream_default_config(void);
+
+/**
+ * @brief Starts one stage thread per node of graph[]
+ *
+ * The graph is validated like fluxion_plan_compile() (no cycles, no
+ * subscriber outside graph[]) and must not be modified until the
+ * stream is destroyed. Nodes belong to their stage meanwhile: inspect
+ * them only after fluxion_stream_wait().
+ *
+ * @return NULL if the graph is invalid or resources are exhausted
+ */
+FluxionStream* fluxion_stream_create(Node* graph[], size_t count, const FluxionStreamConfig* config);
+
+/**
+ * @brief Waits for every pulse, stops the stages and frees the stream
+ */
+void fluxion_stream_destroy(FluxionStream* s);
+
+/**
+ * @brief Sets the payload of a source node for the next pulse
+ *
+ * Only nodes without predecessors in the graph accept emissions. As
+ * with fluxion_emit(), a second emission to the same node within a
+ * pulse is ignored. The payload must stay valid until the pulse has
+ * completed (see fluxion_stream_wait()).
+ *
+ * @return FLUXION_ERR_INVALID_NODE if `target` is not a source of the stream
+ *         FLUXION_ERR_INVALID_ARGUMENT if it is a join (joins are fed by edges)
+ */
+FluxionError fluxion_stream_emit(FluxionStream* s, Node* target, void* data);
+
+/**
+ * @brief Submits the pending emissions as one pulse
+ *
+ * Returns as soon as the sources have accepted the pulse: it blocks
+ * only when their queues are full (backpressure). Without pending
+ * emissions, no pulse is submitted.
+ */
+FluxionError fluxion_stream_pulse(FluxionStream* s);
+
+/**
+ * @brief Waits until every submitted pulse has run through the graph
+ */
+void fluxion_stream_wait(FluxionStream* s);
+
+/**
+ * @brief Reads the stream statistics
+ */
+FluxionStreamStats fluxion_stream_stats(const FluxionStream* s);
+
+#endif /* FLUXION_STREAM_H */
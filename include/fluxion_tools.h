@@ -3,6 +3,9 @@
 
 #include "fluxion_node.h"
 #include "fluxion_runtime.h"
+#include "fluxion_ingest.h"
+#include "fluxion_log.h"
+#include "fluxion_profile.h"
 #include <stddef.h>
 #include <stdint.h>
 
@@ -14,15 +17,30 @@
 /**
  * @brief Health statistics of the Fluxion graph.
  * Provides a global view of the state and efficiency of the pipeline.
+ * Node counts describe the inspected graph; transfer and execution
+ * counters are context-wide, kept up to date by the runtime.
  */
 typedef struct {
     size_t total_nodes;        // Total number of nodes in the graph
-    size_t sleeping_nodes;     // Nodes dormant after a pulse
-    size_t ready_nodes;        // Nodes ready to execute
-    size_t running_nodes;      // Nodes currently executing
-    size_t circular_blockages; // Number of detected cycles
-    uint64_t total_transfers;  // Total number of data transfers
-    double pulse_efficiency;   // Ratio of executed nodes / ready nodes (%)
+    size_t sleeping_nodes;     // Nodes neither ready nor running
+    size_t ready_nodes;        // Nodes queued for the next pulse
+    size_t running_nodes;      // Nodes currently executing (0 between pulses)
+    size_t circular_blockages; // Number of cycles (strongly connected components)
+    uint64_t total_transfers;  // Inputs handed along edges since the context started
+    uint64_t executed_nodes;   // Actions executed since the context started
+    uint64_t pulse_ready;      // Nodes made ready for the last pulse
+    uint64_t pulse_executed;   // Actions executed by the last pulse
+    double pulse_efficiency;   // Ratio of executed nodes / ready nodes in the last pulse (%)
+
+    /* --- Ingestion (see fluxion_inspect_ingest()) --- */
+    uint64_t ingest_offered;   // Items offered to the ingestion queue
+    uint64_t ingest_shed;      // Items dropped by the shedding policy
+    uint64_t ingest_rejected;  // try_push calls that found the ring full (no policy)
+    double shed_rate;          // Ratio of shed / offered items (%)
+
+    /* --- Node profiles (see fluxion_inspect_profiles()) --- */
+    FluxionProfileStats hottest[FLUXION_PROFILE_TOP]; // Most time spent first
+    size_t hottest_count;
 } FluxionMetrics;
 
 /* ============================================================================
@@ -46,7 +64,8 @@ void fluxion_setup_terminal(void);
  * @param graph Array of pointers to nodes
  * @param count Total number of nodes
  * @param filename Name of the DOT file to generate
- * @note The DOT includes colors and labels to indicate node states
+ * @note The DOT includes colors and labels to indicate node states,
+ *       and edges are labelled with their transfer counts
  */
 void fluxion_export_dot(Node* graph[], size_t count, const char* filename);
 
@@ -59,6 +78,8 @@ void fluxion_export_dot(Node* graph[], size_t count, const char* filename);
  * @param graph Array of nodes
  * @param count Number of nodes
  * @param metrics Optional: metrics to display under the graph (NULL if unused)
+ * @note Prints from the calling process: to watch a production pipeline,
+ *       publish its stats instead (fluxion_publish_stats(), tools/fluxion_top.c)
  */
 void fluxion_trace_nodes(Node* graph[], size_t count, FluxionMetrics* metrics);
 
@@ -67,16 +88,18 @@ void fluxion_trace_nodes(Node* graph[], size_t count, FluxionMetrics* metrics);
  * ============================================================================
  */
 
-/**
- * @brief Enables runtime data logging to a CSV file
- * @param ctx Fluxion context
- * @param csv_path Path to the CSV file
- * @note Columns include pulse_id, timestamp, node_count, etc.
- */
-void fluxion_enable_logging(FluxionContext* ctx, const char* csv_path);
+/* Pulse logging: fluxion_enable_logging() (see fluxion_log.h) */
 
 /**
  * @brief Analyzes the graph and returns advanced metrics
+ *
+ * O(1) between ready-queue pulses while the topology is unchanged:
+ * with nothing ready or running in the context, every node of `graph`
+ * sleeps, and the cycle count is recomputed only when `graph` or the
+ * topology version (see fluxion_topology_version()) differs from the
+ * previous call. Otherwise (work pending, full-scan scheduling) node
+ * states are counted over `graph`, in O(count).
+ *
  * @param ctx Fluxion context
  * @param graph Array of nodes
  * @param count Number of nodes
@@ -84,6 +107,33 @@ void fluxion_enable_logging(FluxionContext* ctx, const char* csv_path);
  */
 FluxionMetrics fluxion_inspect(FluxionContext* ctx, Node* graph[], size_t count);
 
+/**
+ * @brief Inputs handed from `src` to `dst` since they were linked
+ * @return 0 if `dst` is not a subscriber of `src`
+ */
+uint64_t fluxion_edge_transfers(const Node* src, const Node* dst);
+
+/**
+ * @brief Adds the load-shedding counters of an ingestion queue to metrics
+ * @param metrics Metrics calculated with fluxion_inspect
+ * @param q Ingestion queue feeding the graph
+ */
+void fluxion_inspect_ingest(FluxionMetrics* metrics, const FluxionIngest* q);
+
+/**
+ * @brief Adds the hottest profiled nodes to metrics (see fluxion_profile.h)
+ * @param metrics Metrics calculated with fluxion_inspect
+ * @param graph Array of nodes
+ * @param count Number of nodes
+ */
+void fluxion_inspect_profiles(FluxionMetrics* metrics, Node* graph[], size_t count);
+
+/**
+ * @brief Prints every cycle of the graph and its members
+ * @return Number of cycles found
+ */
+size_t fluxion_print_cycles(Node* graph[], size_t count);
+
 /* ============================================================================
  * UTILITIES
  * ============================================================================
@@ -0,0 +1,136 @@
+#ifndef FLUXION_TRACE_H
+#define FLUXION_TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "fluxion_runtime.h"
+
+/* ============================================================================
+ * FLUXION — EXECUTION TRACE
+ *
+ * An opt-in tracer recording a span for every pulse, every propagation
+ * (emission) and every executed node action. Each thread appends to its
+ * own lane, without locks: lane 0 is the pulse's thread, lanes 1 and up
+ * the parallel workers, and lanes from FLUXION_TRACE_ASYNC_LANE the I/O
+ * workers of async nodes (their spans are appended by the pulse that
+ * delivers the job). A full lane drops spans (counted).
+ *
+ * fluxion_export_trace() writes Chrome trace-event JSON, which opens in
+ * Perfetto (ui.perfetto.dev) or chrome://tracing. The spans of a pulse
+ * are chained by a flow whose id is the pulse ID.
+ *
+ * When tracing is off, running a node costs one branch on ctx->tracer.
+ * Spans keep the node's name pointer: names must outlive the trace.
+ * ============================================================================
+ */
+
+#define FLUXION_TRACE_CAPACITY   65536  // Default spans per lane
+#define FLUXION_TRACE_LANES      64
+#define FLUXION_TRACE_ASYNC_LANE 32     // Lane of async worker 0
+
+typedef struct FluxionTracer FluxionTracer;
+
+/**
+ * @brief What a span measures
+ */
+typedef enum {
+    FLUXION_TRACE_PULSE = 0,      // fluxion_pulse() or fluxion_pulse_plan()
+    FLUXION_TRACE_PROPAGATE,      // Activation of the nodes reached by an emission
+    FLUXION_TRACE_NODE,           // Executed action of a node
+    FLUXION_TRACE_ASYNC           // Async job, on an I/O worker
+} FluxionTraceKind;
+
+/**
+ * @brief One span (times in ticks until exported)
+ */
+typedef struct {
+    uint64_t begin;
+    uint64_t end;
+    uint64_t pulse_id;
+    const char* name;             // Node name (NULL for pulses)
+    uint32_t kind;                // FluxionTraceKind
+} FluxionTraceSpan;
+
+/**
+ * @brief Tracer counters
+ */
+typedef struct {
+    uint64_t recorded;            // Spans held by the lanes
+    uint64_t dropped;             // Spans lost to a full lane
+    unsigned lanes;               // Lanes that recorded something
+} FluxionTraceStats;
+
+/* ============================================================================
+ * TRACE API
+ * ============================================================================
+ */
+
+/**
+ * @brief Starts tracing a context, discarding any previous trace
+ *
+ * Lanes are allocated by the first span of their thread.
+ * @param capacity Spans per lane (0 = FLUXION_TRACE_CAPACITY)
+ */
+FluxionError fluxion_start_tracing(FluxionContext* ctx, size_t capacity);
+
+/**
+ * @brief Stops tracing and frees the recorded spans
+ */
+void fluxion_stop_tracing(FluxionContext* ctx);
+
+/**
+ * @brief Writes the spans recorded so far as Chrome trace-event JSON
+ *
+ * Call between pulses; tracing goes on afterwards.
+ * @return FLUXION_ERR_INVALID_ARGUMENT if not tracing or the file cannot be opened
+ */
+FluxionError fluxion_export_trace(const FluxionContext* ctx, const char* path);
+
+/**
+ * @brief Reads the tracer counters (zero if not tracing)
+ */
+FluxionTraceStats fluxion_trace_stats(const FluxionContext* ctx);
+
+/**
+ * @brief Appends a span to a lane (runtime hook, lane owner only)
+ */
+void fluxion_trace_record(
+    FluxionTracer* t,
+    unsigned lane,
+    FluxionTraceKind kind,
+    const char* name,
+    uint64_t pulse_id,
+    uint64_t begin,
+    uint64_t end
+);
+
+/**
+ * @brief Runs a node with `run`, timing it if it executed (runtime hook)
+ *
+ * The span goes to `lane` when tracing, and the run to the node's
+ * profile when profiling (see fluxion_profile.h).
+ */
+size_t fluxion_trace_run(
+    FluxionContext* ctx,
+    Node* n,
+    unsigned lane,
+    size_t (*run)(FluxionContext* ctx, Node* n)
+);
+
+/**
+ * @brief Notes the start of a pulse (runtime hook)
+ */
+void fluxion_trace_begin(FluxionTracer* t);
+
+/**
+ * @brief Appends the span of the ending pulse (runtime hook)
+ */
+void fluxion_trace_pulse(FluxionTracer* t, uint64_t pulse_id);
+
+/**
+ * @brief Frees a tracer (runtime hook)
+ */
+void fluxion_trace_destroy(FluxionTracer* t);
+
+#endif /* FLUXION_TRACE_H */
@@ -0,0 +1,90 @@
+#ifndef FLUXION_TYPES_H
+#define FLUXION_TYPES_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* ============================================================================
+ * FLUXION — TYPE REGISTRY
+ *
+ * Data type names are interned once into small integer IDs, so that
+ * link-time and emit-time checks are integer compares. A registered
+ * type also records the size and alignment of its payload, which lets
+ * the runtime copy and batch payloads without guessing.
+ *
+ * The registry is process-wide and append-only; IDs are never reused.
+ * ============================================================================
+ */
+
+#define FLUXION_TYPE_NONE 0     // No declared type (matches anything)
+#define FLUXION_TYPE_MAX  1024  // Capacity of the registry
+
+typedef uint16_t FluxionTypeId;
+
+/**
+ * @brief Description of an interned type
+ */
+typedef struct {
+    const char* name;   // Interned name
+    size_t size;        // Payload size in bytes (0 = unknown)
+    size_t align;       // Payload alignment (0 = unknown)
+} FluxionTypeInfo;
+
+/* ============================================================================
+ * TYPE API
+ * ============================================================================
+ */
+
+/**
+ * @brief Interns a type name
+ *
+ * Unknown names are registered with an unknown size.
+ *
+ * @return The type ID, or FLUXION_TYPE_NONE for NULL or a full registry
+ */
+FluxionTypeId fluxion_type_intern(const char* name);
+
+/**
+ * @brief Interns a type name and records its payload layout
+ *
+ * A name interned earlier keeps its ID and gets the layout; a layout
+ * that contradicts a previous registration is rejected with a warning.
+ */
+FluxionTypeId fluxion_type_register(const char* name, size_t size, size_t align);
+
+/**
+ * @brief Looks a name up without interning it
+ */
+FluxionTypeId fluxion_type_find(const char* name);
+
+/**
+ * @brief Description of a type (NULL for FLUXION_TYPE_NONE or an unknown ID)
+ */
+const FluxionTypeInfo* fluxion_type_info(FluxionTypeId id);
+
+/**
+ * @brief Payload size of a type (0 if unknown)
+ */
+size_t fluxion_type_size(FluxionTypeId id);
+
+/**
+ * @brief Checks whether data of type `src` may flow into `dst`
+ */
+static inline int fluxion_type_compatible(FluxionTypeId src, FluxionTypeId dst) {
+    return src == FLUXION_TYPE_NONE || dst == FLUXION_TYPE_NONE || src == dst;
+}
+
+/**
+ * @brief Alignment of a C type (C99 has no alignof)
+ */
+#define FLUXION_ALIGNOF(T) offsetof(struct { char c; T t; }, t)
+
+/**
+ * @brief Registers a C type under its own name
+ * Usage:
+ *   FLUXION_REGISTER_TYPE(int);
+ */
+#define FLUXION_REGISTER_TYPE(T) \
+    fluxion_type_register(#T, sizeof(T), FLUXION_ALIGNOF(T))
+
+#endif /* FLUXION_TYPES_H */
@@ -0,0 +1,432 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_async.h"
+#include "../include/fluxion_memory.h"
+#include "fluxion_clock.h"
+#include "fluxion_pulse.h"
+#include "fluxion_wait.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * FLUXION — ASYNC WORKERS
+ *
+ * Submissions go through a mutex-protected FIFO: jobs block on I/O for
+ * far longer than the lock is held. A node's jobs are serialized by
+ * its FluxionAsyncNode: a submission finding the node running joins
+ * its backlog, which the running worker drains before letting go.
+ * Completions are pushed on a lock-free stack, taken whole by the
+ * context's thread and reversed into completion order.
+ *
+ * Jobs and input copies come from the executor's slab: once the size
+ * classes in use are warm, a submission does not call malloc().
+ * ============================================================================
+ */
+
+struct FluxionAsync {
+    pthread_t* threads;
+    unsigned workers;
+    unsigned started;             // Workers that picked their index
+
+    /* --- Submissions --- */
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    FluxionAsyncJob* queue;
+    FluxionAsyncJob* queue_tail;
+    int stopping;
+
+    /* --- Completions --- */
+    FluxionAsyncJob* completed;   // Newest first
+    FluxionAsyncJob* deferred;    // Taken, not delivered yet (context thread)
+    FluxionAsyncJob* deferred_tail;
+    FluxionParker waiter;         // Context thread in fluxion_async_wait()
+
+    /* --- Statistics --- */
+    uint64_t submitted;
+    uint64_t finished;
+    uint64_t delivered;
+
+    FluxionSlab jobs;             // Jobs and input copies, recycled per size class
+};
+
+/* ============================================================================
+ * JOB ALLOCATION
+ * ============================================================================
+ */
+
+/**
+ * @brief Allocates a zeroed job
+ */
+static FluxionAsyncJob* fluxion_async_job_new(FluxionAsync* a) {
+    FluxionAsyncJob* job = fluxion_slab_alloc(&a->jobs, sizeof(FluxionAsyncJob));
+    if (job) memset(job, 0, sizeof(FluxionAsyncJob));
+    return job;
+}
+
+/**
+ * @brief Returns a job and its input copy to the slab
+ */
+static void fluxion_async_job_free(FluxionAsync* a, FluxionAsyncJob* job) {
+    if (job->copy) fluxion_slab_free(&a->jobs, job->copy, job->copy_size);
+    fluxion_slab_free(&a->jobs, job, sizeof(FluxionAsyncJob));
+}
+
+/* ============================================================================
+ * WORKERS
+ * ============================================================================
+ */
+
+/**
+ * @brief Runs the async action on a job's input
+ *
+ * A batch runs item by item and is handed on as a whole if any item
+ * produced an output, as with flow actions.
+ */
+static void fluxion_async_run(FluxionAsyncJob* job) {
+    Node* n = job->node;
+
+    if (job->count == 0) {
+        job->output = n->async_action(n, job->data);
+        return;
+    }
+
+    job->output = FLUXION_NO_OUTPUT;
+    char* item = job->data;
+    for (size_t i = 0; i < job->count; i++, item += job->stride) {
+        if (n->async_action(n, item) != FLUXION_NO_OUTPUT) job->output = job->data;
+    }
+}
+
+/**
+ * @brief Publishes a finished job; neither it nor its node may be touched afterwards
+ */
+static void fluxion_async_complete(FluxionAsync* a, FluxionAsyncJob* job) {
+    FluxionAsyncJob* head = __atomic_load_n(&a->completed, __ATOMIC_RELAXED);
+    do {
+        job->next = head;
+    } while (!__atomic_compare_exchange_n(&a->completed, &head, job, 1,
+                                          __ATOMIC_SEQ_CST, __ATOMIC_RELAXED));
+}
+
+static void* fluxion_async_worker(void* arg) {
+    FluxionAsync* a = arg;
+    unsigned self = __atomic_fetch_add(&a->started, 1, __ATOMIC_RELAXED);
+
+    for (;;) {
+        pthread_mutex_lock(&a->lock);
+        while (!a->queue && !a->stopping) pthread_cond_wait(&a->work, &a->lock);
+
+        FluxionAsyncJob* job = a->queue;
+        if (!job) {
+            pthread_mutex_unlock(&a->lock);
+            break;
+        }
+        a->queue = job->next;
+        if (!a->queue) a->queue_tail = NULL;
+        pthread_mutex_unlock(&a->lock);
+
+        /* The node belongs to this worker until its backlog is empty */
+        while (job) {
+            if (job->timed) {
+                job->worker    = self;
+                job->run_begin = fluxion_ticks();
+                fluxion_async_run(job);
+                job->run_end   = fluxion_ticks();
+            } else {
+                fluxion_async_run(job);
+            }
+
+            /*
+             * The next job is chosen before the completion is published:
+             * once delivered, the node may be cleaned up. Publishing under
+             * the lock keeps a node's completions in submission order.
+             */
+            pthread_mutex_lock(&a->lock);
+            FluxionAsyncNode* strand = job->node->async;
+            FluxionAsyncJob* next = strand->backlog;
+            if (next) {
+                strand->backlog = next->next;
+                if (!strand->backlog) strand->backlog_tail = NULL;
+            } else {
+                strand->running = 0;
+            }
+            fluxion_async_complete(a, job);
+            pthread_mutex_unlock(&a->lock);
+
+            __atomic_add_fetch(&a->finished, 1, __ATOMIC_RELAXED);
+            fluxion_parker_wake(&a->waiter);
+            job = next;
+        }
+    }
+
+    return NULL;
+}
+
+/* ============================================================================
+ * CREATION
+ * ============================================================================
+ */
+
+static FluxionAsync* fluxion_async_create(unsigned workers) {
+    FluxionAsync* a = calloc(1, sizeof(FluxionAsync));
+    if (!a) return NULL;
+
+    a->threads = malloc(sizeof(pthread_t) * workers);
+    if (!a->threads) {
+        free(a);
+        return NULL;
+    }
+
+    pthread_mutex_init(&a->lock, NULL);
+    pthread_cond_init(&a->work, NULL);
+    fluxion_parker_init(&a->waiter);
+    fluxion_slab_init(&a->jobs);
+
+    for (unsigned i = 0; i < workers; i++) {
+        if (pthread_create(&a->threads[i], NULL, fluxion_async_worker, a) != 0) break;
+        a->workers++;
+    }
+
+    if (a->workers == 0) {
+        fluxion_async_destroy(a);
+        return NULL;
+    }
+    return a;
+}
+
+void fluxion_async_destroy(FluxionAsync* a) {
+    if (!a) return;
+
+    /* Workers leave once the queue is empty: every job still runs */
+    pthread_mutex_lock(&a->lock);
+    a->stopping = 1;
+    pthread_cond_broadcast(&a->work);
+    pthread_mutex_unlock(&a->lock);
+
+    for (unsigned i = 0; i < a->workers; i++) pthread_join(a->threads[i], NULL);
+
+    FluxionAsyncJob* lists[2] = { a->deferred, a->completed };
+    for (int i = 0; i < 2; i++) {
+        FluxionAsyncJob* job = lists[i];
+        while (job) {
+            FluxionAsyncJob* next = job->next;
+            fluxion_async_job_free(a, job);
+            job = next;
+        }
+    }
+
+    fluxion_slab_release(&a->jobs);
+    fluxion_parker_destroy(&a->waiter);
+    pthread_cond_destroy(&a->work);
+    pthread_mutex_destroy(&a->lock);
+    free(a->threads);
+    free(a);
+}
+
+static inline uint64_t fluxion_async_in_flight(const FluxionAsync* a) {
+    return __atomic_load_n(&a->submitted, __ATOMIC_ACQUIRE) - __atomic_load_n(&a->delivered, __ATOMIC_ACQUIRE);
+}
+
+FluxionError fluxion_set_async_workers(FluxionContext* ctx, unsigned workers) {
+    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
+    if (workers == 0) return FLUXION_ERR_INVALID_ARGUMENT;
+
+    if (ctx->async) {
+        if (ctx->async->workers == workers) return FLUXION_OK;
+        if (fluxion_async_in_flight(ctx->async) > 0) return FLUXION_ERR_INVALID_ARGUMENT;
+        fluxion_async_destroy(ctx->async);
+        ctx->async = NULL;
+    }
+
+    ctx->async = fluxion_async_create(workers);
+    if (!ctx->async) {
+        fprintf(stderr, "[Fluxion] Failed to start %u async workers\n", workers);
+        return FLUXION_ERR_OUT_OF_MEMORY;
+    }
+    return FLUXION_OK;
+}
+
+/* ============================================================================
+ * SUBMISSION AND COMPLETION
+ * ============================================================================
+ */
+
+/**
+ * @brief Workers of the context, started on first use
+ *
+ * Parallel pulses may race here: the first published executor wins.
+ */
+static FluxionAsync* fluxion_async_executor(FluxionContext* ctx) {
+    FluxionAsync* a = __atomic_load_n(&ctx->async, __ATOMIC_ACQUIRE);
+    if (a) return a;
+
+    FluxionAsync* created = fluxion_async_create(FLUXION_ASYNC_DEFAULT_WORKERS);
+    if (!created) return NULL;
+
+    if (!__atomic_compare_exchange_n(&ctx->async, &a, created, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        fluxion_async_destroy(created);
+        return a;
+    }
+    return created;
+}
+
+FluxionError fluxion_async_submit(FluxionContext* ctx, Node* n) {
+    FluxionAsync* a = fluxion_async_executor(ctx);
+    if (!a) return FLUXION_ERR_OUT_OF_MEMORY;
+
+    FluxionAsyncJob* job = fluxion_async_job_new(a);
+    if (!job) return FLUXION_ERR_OUT_OF_MEMORY;
+
+    job->node     = n;
+    job->data     = n->input_buffer;
+    job->count    = n->input_count;
+    job->stride   = n->input_stride;
+    job->pulse_id = ctx->current_pulse;
+    job->timed    = ctx->tracer || ctx->profiling;
+    if (job->timed) job->submit_ticks = fluxion_ticks();
+
+    /*
+     * Pulse-arena messages are reclaimed when the pulse ends, and batches
+     * may live in runtime buffers (a coalescer's) refilled meanwhile
+     */
+    if (n->input_buffer && (n->input_origin || n->input_count)) {
+        job->copy_size = n->input_origin ? fluxion_msg_size(n->input_buffer)
+                                         : n->input_count * n->input_stride;
+        job->copy = fluxion_slab_alloc(&a->jobs, job->copy_size);
+        if (!job->copy) {
+            fluxion_async_job_free(a, job);
+            return FLUXION_ERR_OUT_OF_MEMORY;
+        }
+        memcpy(job->copy, n->input_buffer, job->copy_size);
+        job->data = job->copy;
+    }
+
+    pthread_mutex_lock(&a->lock);
+
+    if (!n->async) {
+        n->async = calloc(1, sizeof(FluxionAsyncNode));
+        if (!n->async) {
+            pthread_mutex_unlock(&a->lock);
+            fluxion_async_job_free(a, job);
+            return FLUXION_ERR_OUT_OF_MEMORY;
+        }
+    }
+
+    FluxionAsyncNode* strand = n->async;
+    if (strand->running) {
+        if (strand->backlog_tail) strand->backlog_tail->next = job;
+        else strand->backlog = job;
+        strand->backlog_tail = job;
+    } else {
+        strand->running = 1;
+        if (a->queue_tail) a->queue_tail->next = job;
+        else a->queue = job;
+        a->queue_tail = job;
+        pthread_cond_signal(&a->work);
+    }
+
+    __atomic_add_fetch(&a->submitted, 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&a->lock);
+    return FLUXION_OK;
+}
+
+FluxionAsyncJob* fluxion_async_take(FluxionAsync* a) {
+    if (!a) return NULL;
+
+    FluxionAsyncJob* ordered = a->deferred;
+    FluxionAsyncJob* tail = a->deferred_tail;
+    a->deferred = NULL;
+    a->deferred_tail = NULL;
+
+    if (!__atomic_load_n(&a->completed, __ATOMIC_RELAXED)) return ordered;
+    FluxionAsyncJob* job = __atomic_exchange_n(&a->completed, NULL, __ATOMIC_ACQUIRE);
+
+    /* Newest first: reverse into completion order */
+    FluxionAsyncJob* fresh = NULL;
+    while (job) {
+        FluxionAsyncJob* next = job->next;
+        job->next = fresh;
+        fresh = job;
+        job = next;
+    }
+
+    if (!tail) return fresh;
+    tail->next = fresh;
+    return ordered;
+}
+
+void fluxion_async_defer(FluxionAsync* a, FluxionAsyncJob* job) {
+    job->next = NULL;
+    if (a->deferred_tail) a->deferred_tail->next = job;
+    else a->deferred = job;
+    a->deferred_tail = job;
+}
+
+void fluxion_async_done(FluxionAsync* a, FluxionAsyncJob* job) {
+    fluxion_async_job_free(a, job);
+    __atomic_add_fetch(&a->delivered, 1, __ATOMIC_RELEASE);
+}
+
+/* ============================================================================
+ * POLLING
+ * ============================================================================
+ */
+
+static inline int fluxion_async_pending(const FluxionAsync* a) {
+    return a->deferred || __atomic_load_n(&a->completed, __ATOMIC_ACQUIRE);
+}
+
+size_t fluxion_async_poll(FluxionContext* ctx) {
+    if (!ctx || !ctx->async) return 0;
+
+    /*
+     * Completions are delivered when a pulse starts. Full scan has no
+     * graph to walk here: these pulses run the ready queue instead, so
+     * that they always end and a deferred completion gets its turn.
+     */
+    uint64_t before = ctx->async->delivered;
+    while (ctx->async->delivered == before && fluxion_async_pending(ctx->async)) {
+        fluxion_pulse_ready(ctx);
+    }
+
+    return (size_t)(ctx->async->delivered - before);
+}
+
+static int fluxion_async_completed(const void* arg) {
+    const FluxionAsync* a = arg;
+    return __atomic_load_n(&a->completed, __ATOMIC_SEQ_CST) != NULL;
+}
+
+size_t fluxion_async_wait(FluxionContext* ctx) {
+    if (!ctx || !ctx->async) return 0;
+
+    size_t total = 0;
+    while (fluxion_async_in_flight(ctx->async) > 0) {
+        size_t delivered = fluxion_async_poll(ctx);
+        total += delivered;
+        if (delivered == 0) fluxion_parker_park(&ctx->async->waiter, fluxion_async_completed, ctx->async);
+    }
+    return total;
+}
+
+FluxionAsyncStats fluxion_async_stats(const FluxionContext* ctx) {
+    FluxionAsyncStats stats = { 0, 0, 0, 0 };
+    if (!ctx || !ctx->async) return stats;
+
+    const FluxionAsync* a = ctx->async;
+    stats.submitted = __atomic_load_n(&a->submitted, __ATOMIC_RELAXED);
+    stats.completed = __atomic_load_n(&a->finished, __ATOMIC_RELAXED);
+    stats.delivered = __atomic_load_n(&a->delivered, __ATOMIC_RELAXED);
+    stats.in_flight = stats.submitted - stats.delivered;
+    return stats;
+}
+
+void fluxion_async_node_destroy(Node* n) {
+    if (!n || !n->async) return;
+
+    free(n->async);
+    n->async = NULL;
+}
@@ -0,0 +1,524 @@
+#include "../include/fluxion_builder.h"
+#include "../include/fluxion_join.h"
+#include "../include/fluxion_cycles.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * FLUXION — HASH INDEXES
+ *
+ * Open addressing with linear probing; tables are kept at most half
+ * full. Edge removal uses backward-shift deletion (no tombstones).
+ * The edge index is only built when a single edge has to be found
+ * (unlink, single link); bulk insertion does without it.
+ * ============================================================================
+ */
+
+struct FluxionUidSlot {
+    Node* node;        // NULL = empty slot
+    uint32_t uid;      // node->uid, compared without touching the node
+    size_t last_run;   // Last run of edges from this node (bulk insertion, may be stale)
+    uint64_t stamp;    // Source group that last reached this node (bulk insertion)
+};
+
+/**
+ * @brief Consecutive edges of a bulk list sharing their source
+ */
+struct FluxionBulkRun {
+    struct FluxionUidSlot* source;
+    size_t begin;      // First edge of the run
+    size_t end;        // One past its last edge
+    size_t next;       // Next run of the same source (0 = none)
+    int head;          // First run of its source
+};
+
+struct FluxionEdgeSlot {
+    uint64_t key;      // Source UID (high half), destination UID (low half)
+    uint32_t position; // Index of dst in src->subscribers, plus one (0 = empty slot)
+};
+
+static inline uint64_t fluxion_edge_key(const Node* src, const Node* dst) {
+    return ((uint64_t)src->uid << 32) | dst->uid;
+}
+
+static inline size_t fluxion_hash(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return (size_t)x;
+}
+
+static size_t fluxion_table_capacity(size_t entries) {
+    size_t capacity = 16;
+    while (capacity < entries * 2) capacity *= 2;
+    return capacity;
+}
+
+/* --- UID index --- */
+
+static struct FluxionUidSlot* fluxion_uid_slot(const FluxionBuilder* b, uint32_t uid) {
+    size_t mask = b->node_capacity - 1;
+    size_t i = fluxion_hash(uid) & mask;
+
+    while (b->nodes[i].node && b->nodes[i].uid != uid) i = (i + 1) & mask;
+    return &b->nodes[i];
+}
+
+static int fluxion_uid_reserve(FluxionBuilder* b, size_t entries) {
+    if (entries * 2 <= b->node_capacity) return 1;
+
+    size_t capacity = fluxion_table_capacity(entries);
+    struct FluxionUidSlot* old = b->nodes;
+    size_t old_capacity = b->node_capacity;
+
+    b->nodes = calloc(capacity, sizeof(struct FluxionUidSlot));
+    if (!b->nodes) {
+        b->nodes = old;
+        return 0;
+    }
+    b->node_capacity = capacity;
+
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old[i].node) *fluxion_uid_slot(b, old[i].uid) = old[i];
+    }
+
+    free(old);
+    return 1;
+}
+
+/* --- Edge index --- */
+
+static struct FluxionEdgeSlot* fluxion_edge_slot(const FluxionBuilder* b, uint64_t key) {
+    size_t mask = b->edge_capacity - 1;
+    size_t i = fluxion_hash(key) & mask;
+
+    while (b->edges[i].position && b->edges[i].key != key) i = (i + 1) & mask;
+    return &b->edges[i];
+}
+
+static int fluxion_edge_reserve(FluxionBuilder* b, size_t entries) {
+    if (b->edges && entries * 2 <= b->edge_capacity) return 1;
+
+    size_t capacity = fluxion_table_capacity(entries);
+    struct FluxionEdgeSlot* old = b->edges;
+    size_t old_capacity = b->edge_capacity;
+
+    b->edges = calloc(capacity, sizeof(struct FluxionEdgeSlot));
+    if (!b->edges) {
+        b->edges = old;
+        return 0;
+    }
+    b->edge_capacity = capacity;
+
+    for (size_t i = 0; i < old_capacity; i++) {
+        if (old[i].position) *fluxion_edge_slot(b, old[i].key) = old[i];
+    }
+
+    free(old);
+    return 1;
+}
+
+/**
+ * @brief Removes an occupied slot, shifting back the entries of its probe run
+ */
+static void fluxion_edge_erase(FluxionBuilder* b, struct FluxionEdgeSlot* slot) {
+    size_t mask = b->edge_capacity - 1;
+    size_t hole = (size_t)(slot - b->edges);
+    size_t i = hole;
+
+    for (;;) {
+        i = (i + 1) & mask;
+        if (!b->edges[i].position) break;
+
+        /* An entry may fill the hole only if its home is not in (hole, i] */
+        size_t home = fluxion_hash(b->edges[i].key) & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            b->edges[hole] = b->edges[i];
+            hole = i;
+        }
+    }
+
+    b->edges[hole].position = 0;
+    b->edge_count--;
+}
+
+/**
+ * @brief Indexes an edge, keeping the first position of duplicates
+ */
+static void fluxion_edge_index(FluxionBuilder* b, const Node* src, const Node* dst, size_t index) {
+    uint64_t key = fluxion_edge_key(src, dst);
+    struct FluxionEdgeSlot* slot = fluxion_edge_slot(b, key);
+    if (slot->position) return;
+
+    slot->key      = key;
+    slot->position = (uint32_t)index + 1;
+    b->edge_count++;
+}
+
+/**
+ * @brief Indexes the links of every registered node, once
+ */
+static int fluxion_edge_index_build(FluxionBuilder* b) {
+    if (b->edges_indexed) return 1;
+
+    size_t links = 0;
+    for (size_t i = 0; i < b->node_capacity; i++) {
+        if (b->nodes[i].node) links += b->nodes[i].node->subscriber_count;
+    }
+    if (!fluxion_edge_reserve(b, links)) return 0;
+
+    for (size_t i = 0; i < b->node_capacity; i++) {
+        Node* n = b->nodes[i].node;
+        if (!n) continue;
+        for (size_t k = 0; k < n->subscriber_count; k++) fluxion_edge_index(b, n, n->subscribers[k], k);
+    }
+
+    b->edges_indexed = 1;
+    return 1;
+}
+
+/* ============================================================================
+ * BUILDER API
+ * ============================================================================
+ */
+
+FluxionBuilder* fluxion_builder_create(size_t expected_nodes) {
+    FluxionBuilder* b = calloc(1, sizeof(FluxionBuilder));
+    if (!b) return NULL;
+
+    b->node_capacity = fluxion_table_capacity(expected_nodes);
+    b->nodes = calloc(b->node_capacity, sizeof(struct FluxionUidSlot));
+
+    if (!b->nodes) {
+        fluxion_builder_destroy(b);
+        return NULL;
+    }
+
+    return b;
+}
+
+void fluxion_builder_destroy(FluxionBuilder* b) {
+    if (!b) return;
+
+    free(b->nodes);
+    free(b->edges);
+    free(b);
+}
+
+FluxionError fluxion_builder_add(FluxionBuilder* b, Node* n) {
+    if (!b) return FLUXION_ERR_NULL_CONTEXT;
+    if (!n) return FLUXION_ERR_INVALID_NODE;
+
+    if (!fluxion_uid_reserve(b, b->node_count + 1) ||
+        (b->edges_indexed && !fluxion_edge_reserve(b, b->edge_count + n->subscriber_count))) {
+        return FLUXION_ERR_OUT_OF_MEMORY;
+    }
+
+    struct FluxionUidSlot* slot = fluxion_uid_slot(b, n->uid);
+    if (slot->node == n) return FLUXION_OK;
+
+    if (slot->node) {
+        fprintf(stderr,
+            "[Fluxion] Builder: UID %u of '%s' is already used by '%s'\n",
+            n->uid, n->name, slot->node->name);
+        return FLUXION_ERR_INVALID_ARGUMENT;
+    }
+
+    slot->node    = n;
+    slot->uid      = n->uid;
+    slot->last_run = 0;
+    slot->stamp    = 0;
+    b->node_count++;
+
+    if (!b->edges_indexed) return FLUXION_OK;
+    for (size_t i = 0; i < n->subscriber_count; i++) {
+        fluxion_edge_index(b, n, n->subscribers[i], i);
+    }
+
+    return FLUXION_OK;
+}
+
+FluxionError fluxion_builder_add_nodes(FluxionBuilder* b, Node* nodes[], size_t count) {
+    if (!b) return FLUXION_ERR_NULL_CONTEXT;
+    if (!nodes && count > 0) return FLUXION_ERR_INVALID_ARGUMENT;
+
+    if (!fluxion_uid_reserve(b, b->node_count + count)) return FLUXION_ERR_OUT_OF_MEMORY;
+
+    for (size_t i = 0; i < count; i++) {
+        if (!nodes[i]) continue;
+
+        FluxionError err = fluxion_builder_add(b, nodes[i]);
+        if (err != FLUXION_OK) return err;
+    }
+
+    return FLUXION_OK;
+}
+
+Node* fluxion_builder_find(const FluxionBuilder* b, uint32_t uid) {
+    if (!b) return NULL;
+    return fluxion_uid_slot(b, uid)->node;
+}
+
+FluxionError fluxion_builder_link(FluxionBuilder* b, uint32_t src, uint32_t dst) {
+    if (!b) return FLUXION_ERR_NULL_CONTEXT;
+
+    Node* s = fluxion_builder_find(b, src);
+    Node* d = fluxion_builder_find(b, dst);
+    if (!s || !d) return FLUXION_ERR_INVALID_NODE;
+
+    if (!fluxion_edge_index_build(b) || !fluxion_edge_reserve(b, b->edge_count + 1)) {
+        return FLUXION_ERR_OUT_OF_MEMORY;
+    }
+
+    uint64_t key = fluxion_edge_key(s, d);
+    struct FluxionEdgeSlot* slot = fluxion_edge_slot(b, key);
+    if (slot->position) return FLUXION_OK;
+
+    FluxionError err = fluxion_link(s, d);
+    if (err != FLUXION_OK) return err;
+
+    slot->key      = key;
+    slot->position = (uint32_t)s->subscriber_count;
+    b->edge_count++;
+    return FLUXION_OK;
+}
+
+/**
+ * @brief Grows a bulk scratch array geometrically
+ */
+static int fluxion_bulk_grow(void** buffer, size_t* capacity, size_t needed, size_t item) {
+    if (needed <= *capacity) return 1;
+
+    size_t grown = *capacity ? *capacity * 2 : 16;
+    while (grown < needed) grown *= 2;
+
+    void* tmp = realloc(*buffer, grown * item);
+    if (!tmp) return 0;
+
+    *buffer = tmp;
+    *capacity = grown;
+    return 1;
+}
+
+static int fluxion_bulk_compare(const void* a, const void* b) {
+    size_t x = *(const size_t*)a;
+    size_t y = *(const size_t*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Starts a stamp group: marks the nodes already linked to src
+ */
+static uint64_t fluxion_bulk_stamp(FluxionBuilder* b, const Node* src) {
+    uint64_t stamp = ++b->stamp;
+
+    for (size_t i = 0; i < src->subscriber_count; i++) {
+        struct FluxionUidSlot* linked = fluxion_uid_slot(b, src->subscribers[i]->uid);
+        if (linked->node == src->subscribers[i]) linked->stamp = stamp;
+    }
+    return stamp;
+}
+
+FluxionError fluxion_builder_link_bulk(FluxionBuilder* b, const FluxionEdge* edges, size_t count) {
+    if (!b) return FLUXION_ERR_NULL_CONTEXT;
+    if (!edges && count > 0) return FLUXION_ERR_INVALID_ARGUMENT;
+    if (count == 0) return FLUXION_OK;
+
+    /* Resolved destinations (NULL = repeated edge): each UID is looked up once */
+    Node** targets = malloc(sizeof(Node*) * count);
+    struct FluxionBulkRun* runs = NULL;
+    size_t* deferred = NULL;
+    size_t run_count = 0, run_capacity = 0;
+    size_t deferred_count = 0, deferred_capacity = 0;
+    FluxionError err = FLUXION_OK;
+
+    if (!targets || (b->edges_indexed && !fluxion_edge_reserve(b, b->edge_count + count))) {
+        err = FLUXION_ERR_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /*
+     * Pass 1: split the list into runs of one source and resolve the
+     * endpoints. The nodes linked to a source carry the stamp of its
+     * group, so the first run of each source drops its repeated edges
+     * here, without the edge index.
+     */
+    for (size_t i = 0; i < count && err == FLUXION_OK; ) {
+        struct FluxionUidSlot* src = fluxion_uid_slot(b, edges[i].src);
+        if (!src->node) {
+            fprintf(stderr, "[Fluxion] Builder: unknown UID in edge %u -> %u\n", edges[i].src, edges[i].dst);
+            err = FLUXION_ERR_INVALID_NODE;
+            break;
+        }
+
+        void* grown = runs;
+        if (!fluxion_bulk_grow(&grown, &run_capacity, run_count + 1, sizeof(struct FluxionBulkRun))) {
+            err = FLUXION_ERR_OUT_OF_MEMORY;
+            break;
+        }
+        runs = grown;
+
+        /* A stale last_run cannot name a run of this source in this list */
+        struct FluxionBulkRun* run = &runs[run_count];
+        run->source = src;
+        run->begin  = i;
+        run->next   = 0;
+        run->head   = !(src->last_run < run_count && runs[src->last_run].source == src);
+        if (!run->head) runs[src->last_run].next = run_count;
+        src->last_run = run_count++;
+
+        uint64_t stamp = run->head ? fluxion_bulk_stamp(b, src->node) : 0;
+        for (; i < count && edges[i].src == src->uid; i++) {
+            struct FluxionUidSlot* dst = fluxion_uid_slot(b, edges[i].dst);
+            if (!dst->node) {
+                fprintf(stderr, "[Fluxion] Builder: unknown UID in edge %u -> %u\n",
+                        edges[i].src, edges[i].dst);
+                err = FLUXION_ERR_INVALID_NODE;
+                break;
+            }
+
+            targets[i] = (stamp && dst->stamp == stamp) ? NULL : dst->node;
+            if (stamp) dst->stamp = stamp;
+        }
+        run->end = i;
+    }
+
+    if (err != FLUXION_OK) goto done;
+
+    /* Pass 2: grow every subscriber array once */
+    for (size_t r = 0; r < run_count; r++) {
+        if (!runs[r].head) continue;
+
+        size_t pending = 0;
+        for (size_t q = r; ; q = runs[q].next) {
+            pending += runs[q].end - runs[q].begin;
+            if (!runs[q].next) break;
+        }
+
+        Node* n = runs[r].source->node;
+        if (!fluxion_node_reserve_subscribers(n, n->subscriber_count + pending)) {
+            err = FLUXION_ERR_OUT_OF_MEMORY;
+            goto done;
+        }
+    }
+
+    /*
+     * Pass 3: append, source by source (no allocation left). A source
+     * split over several runs is checked against a fresh stamp group,
+     * taken before its first edge so that deferred edges are stamped
+     * too. Edges against the current order, and fan-in edges, are left
+     * for the checked path.
+     */
+    size_t added = 0;
+    for (size_t r = 0; r < run_count; r++) {
+        if (!runs[r].head) continue;
+
+        Node* src = runs[r].source->node;
+        FluxionTypeId src_type = fluxion_node_type_id(src);
+        uint64_t stamp = runs[r].next ? fluxion_bulk_stamp(b, src) : 0;
+
+        for (size_t q = r; ; q = runs[q].next) {
+            for (size_t e = runs[q].begin; e < runs[q].end; e++) {
+                Node* dst = targets[e];
+                if (!dst) continue;
+
+                if (stamp) {
+                    struct FluxionUidSlot* target = fluxion_uid_slot(b, dst->uid);
+                    if (target->stamp == stamp) continue;
+                    target->stamp = stamp;
+                }
+
+                if (dst == src || dst->join ||
+                    (src->topo_order && dst->topo_order && src->topo_order >= dst->topo_order)) {
+                    void* grown = deferred;
+                    if (!fluxion_bulk_grow(&grown, &deferred_capacity, deferred_count + 1, sizeof(size_t))) {
+                        err = FLUXION_ERR_OUT_OF_MEMORY;
+                        continue;
+                    }
+                    deferred = grown;
+                    deferred[deferred_count++] = e;
+                    continue;
+                }
+
+                if (!fluxion_type_compatible(src_type, fluxion_node_type_id(dst))) {
+                    fprintf(stderr,
+                        "[Fluxion] Warning: type mismatch %s(%s) -> %s(%s)\n",
+                        src->name, src->data_type,
+                        dst->name, dst->data_type
+                    );
+                }
+
+                /* O(1): a new node goes first (source) or last (sink) */
+                if (!src->topo_order || !dst->topo_order) fluxion_topo_insert(src, dst);
+
+                size_t index = src->subscriber_count++;
+                src->edge_transfers[index] = 0;
+                src->subscribers[index] = dst;
+                if (b->edges_indexed) fluxion_edge_index(b, src, dst, index);
+                added++;
+            }
+            if (!runs[q].next) break;
+        }
+    }
+    if (added) fluxion_topology_changed();
+
+    /* Checked path, in list order (join slots bind as listed); cycle-closing edges are skipped */
+    if (deferred_count > 1) qsort(deferred, deferred_count, sizeof(size_t), fluxion_bulk_compare);
+    for (size_t k = 0; k < deferred_count; k++) {
+        Node* src = fluxion_builder_find(b, edges[deferred[k]].src);
+        Node* dst = targets[deferred[k]];
+
+        FluxionError link_err = fluxion_link(src, dst);
+        if (link_err != FLUXION_OK) {
+            err = link_err;
+            continue;
+        }
+        if (b->edges_indexed) fluxion_edge_index(b, src, dst, src->subscriber_count - 1);
+    }
+
+done:
+    free(targets);
+    free(runs);
+    free(deferred);
+    return err;
+}
+
+FluxionError fluxion_builder_unlink(FluxionBuilder* b, uint32_t src, uint32_t dst) {
+    if (!b) return FLUXION_ERR_NULL_CONTEXT;
+
+    Node* s = fluxion_builder_find(b, src);
+    Node* d = fluxion_builder_find(b, dst);
+    if (!s || !d) return FLUXION_ERR_INVALID_NODE;
+    if (!fluxion_edge_index_build(b)) return FLUXION_ERR_OUT_OF_MEMORY;
+
+    struct FluxionEdgeSlot* slot = fluxion_edge_slot(b, fluxion_edge_key(s, d));
+    if (!slot->position) return FLUXION_ERR_INVALID_NODE;
+
+    size_t index = slot->position - 1;
+    if (index >= s->subscriber_count || s->subscribers[index] != d) {
+        fprintf(stderr, "[Fluxion] Builder: stale edge index for '%s' -> '%s'\n", s->name, d->name);
+        return FLUXION_ERR_INVALID_NODE;
+    }
+
+    size_t last = s->subscriber_count - 1;
+    fluxion_edge_erase(b, slot);
+
+    /* Swap-remove: the last subscriber fills the gap */
+    if (index != last) {
+        Node* moved = s->subscribers[last];
+        s->subscribers[index] = moved;
+        if (s->edge_transfers) s->edge_transfers[index] = s->edge_transfers[last];
+
+        struct FluxionEdgeSlot* moved_slot = fluxion_edge_slot(b, fluxion_edge_key(s, moved));
+        if (moved_slot->position == last + 1) moved_slot->position = (uint32_t)index + 1;
+    }
+
+    s->subscriber_count--;
+    fluxion_topology_changed();
+    if (d->join) fluxion_join_unbind(d, s);
+    return FLUXION_OK;
+}
@@ -0,0 +1,48 @@
+#ifndef FLUXION_CLOCK_H
+#define FLUXION_CLOCK_H
+
+#include <stdint.h>
+
+#include "../include/fluxion_runtime.h"
+
+/* ============================================================================
+ * FLUXION — TICKS (INTERNAL)
+ *
+ * Shared by the pulse log and the tracer: hot paths read the CPU's
+ * timestamp counter where there is one (x86), which costs about half a
+ * clock read; tick counts are converted to fluxion_time_ns() off the
+ * hot path, against clock readings taken at both ends of the interval.
+ * Elsewhere ticks are fluxion_time_ns() nanoseconds.
+ * ============================================================================
+ */
+
+#if defined(__x86_64__) || defined(__i386__)
+#define FLUXION_TICKS_TSC 1
+#else
+#define FLUXION_TICKS_TSC 0
+#endif
+
+static inline uint64_t fluxion_ticks(void) {
+#if FLUXION_TICKS_TSC
+    return __builtin_ia32_rdtsc();
+#else
+    return fluxion_time_ns();
+#endif
+}
+
+/**
+ * @brief Nanoseconds per tick between two (ticks, ns) readings
+ */
+static inline double fluxion_ticks_rate(uint64_t ticks0, uint64_t ns0, uint64_t ticks1, uint64_t ns1) {
+#if FLUXION_TICKS_TSC
+    return (ticks1 > ticks0) ? (double)(ns1 - ns0) / (double)(ticks1 - ticks0) : 0.0;
+#else
+    (void)ticks0;
+    (void)ns0;
+    (void)ticks1;
+    (void)ns1;
+    return 1.0;
+#endif
+}
+
+#endif /* FLUXION_CLOCK_H */
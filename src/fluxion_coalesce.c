@@ -0,0 +1,228 @@
+#include "../include/fluxion_coalesce.h"
+#include "../include/fluxion_memory.h"
+#include "../include/fluxion_types.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * FLUXION — COALESCING IMPLEMENTATION
+ * ============================================================================
+ */
+
+FluxionError fluxion_set_coalescing(Node* n, FluxionCoalescePolicy policy, uint64_t window_ns) {
+    if (!n) return FLUXION_ERR_INVALID_NODE;
+    if (policy == FLUXION_COALESCE_MAX_RATE && window_ns == 0) return FLUXION_ERR_INVALID_ARGUMENT;
+
+    size_t item_size = 0;
+    if (policy == FLUXION_COALESCE_ACCUMULATE) {
+        item_size = fluxion_type_size(fluxion_node_type_id(n));
+        if (item_size == 0) {
+            fprintf(stderr, "[Fluxion] Cannot accumulate '%s': type %s has no registered size\n",
+                    n->name, n->data_type ? n->data_type : "(none)");
+            return FLUXION_ERR_INVALID_ARGUMENT;
+        }
+    }
+
+    if (!n->coalesce) {
+        if (policy == FLUXION_COALESCE_NONE) return FLUXION_OK;
+
+        n->coalesce = calloc(1, sizeof(FluxionCoalesce));
+        if (!n->coalesce) {
+            fprintf(stderr, "[Fluxion] Failed to allocate coalescing state for node '%s'\n", n->name);
+            return FLUXION_ERR_OUT_OF_MEMORY;
+        }
+    }
+
+    FluxionCoalesce* c = n->coalesce;
+
+    /* A held emission keeps the layout it was merged with */
+    int accumulating = c->policy == FLUXION_COALESCE_ACCUMULATE;
+    if (c->pending && accumulating != (policy == FLUXION_COALESCE_ACCUMULATE)) {
+        fprintf(stderr, "[Fluxion] Coalescing of '%s' changed while an emission is held\n", n->name);
+        return FLUXION_ERR_INVALID_ARGUMENT;
+    }
+
+    c->policy    = policy;
+    c->window_ns = window_ns;
+    if (item_size) c->item_size = item_size;
+    return FLUXION_OK;
+}
+
+FluxionCoalesceStats fluxion_coalesce_stats(const Node* n) {
+    FluxionCoalesceStats none = { 0, 0, 0 };
+    return (n && n->coalesce) ? n->coalesce->stats : none;
+}
+
+/* ============================================================================
+ * HELD EMISSIONS
+ * ============================================================================
+ */
+
+/**
+ * @brief Ensures the filling batch can hold `needed` items
+ *
+ * Grows geometrically: a steady emission rate stops allocating.
+ */
+static int fluxion_coalesce_reserve(FluxionCoalesce* c, size_t needed) {
+    int b = c->filling;
+    if (needed <= c->items_capacity[b]) return 1;
+
+    size_t capacity = c->items_capacity[b] ? c->items_capacity[b] : 64;
+    while (capacity < needed) capacity *= 2;
+
+    unsigned char* tmp = realloc(c->items[b], capacity * c->item_size);
+    if (!tmp) return 0;
+
+    c->items[b] = tmp;
+    c->items_capacity[b] = capacity;
+    return 1;
+}
+
+FluxionError fluxion_coalesce_hold(FluxionCoalesce* c, void* data, size_t count, size_t stride, int msg) {
+    c->stats.emits++;
+
+    if (c->policy != FLUXION_COALESCE_ACCUMULATE) {
+        /* Latest value wins: the previous one is dropped unseen */
+        if (c->pending) c->stats.coalesced++;
+        if (c->msg) fluxion_msg_release(c->data);
+        c->data    = data;
+        c->count   = count;
+        c->stride  = stride;
+        c->msg     = msg;
+        c->spilled = 0;
+        return FLUXION_OK;
+    }
+
+    if (!data) return FLUXION_ERR_INVALID_ARGUMENT;
+
+    size_t items = count ? count : 1;
+    size_t step  = (count && stride) ? stride : c->item_size;
+
+    if (!fluxion_coalesce_reserve(c, c->count + items)) {
+        if (msg) fluxion_msg_release(data);
+        return FLUXION_ERR_OUT_OF_MEMORY;
+    }
+
+    unsigned char* dst = c->items[c->filling] + c->count * c->item_size;
+    if (step == c->item_size) {
+        memcpy(dst, data, items * c->item_size);
+    } else {
+        const unsigned char* src = data;
+        for (size_t i = 0; i < items; i++) memcpy(dst + i * c->item_size, src + i * step, c->item_size);
+    }
+    c->count += items;
+    if (c->pending) c->stats.coalesced++;
+
+    /* The payload was copied: the emitter's reference is not needed */
+    if (msg) fluxion_msg_release(data);
+    return FLUXION_OK;
+}
+
+int fluxion_coalesce_due(const FluxionCoalesce* c, uint64_t now) {
+    return c->window_ns == 0 || now - c->last_flush_ns >= c->window_ns;
+}
+
+void fluxion_coalesce_take(
+    FluxionCoalesce* c,
+    FluxionArena* arena,
+    uint64_t now,
+    void** data,
+    size_t* count,
+    size_t* stride,
+    int* msg
+) {
+    if (c->policy == FLUXION_COALESCE_ACCUMULATE) {
+        /* The batch in flight stays intact while the other one fills */
+        *data   = c->items[c->filling];
+        *count  = c->count;
+        *stride = c->item_size;
+        *msg    = 0;
+        c->filling ^= 1;
+    } else {
+        *data   = c->data;
+        *count  = c->count;
+        *stride = c->stride;
+        *msg    = c->msg;
+
+        /* The spill buffer is refilled by later pulses: hand over a message instead */
+        if (c->spilled) {
+            void* copy = fluxion_msg_create(arena, c->spilled);
+            if (copy) {
+                memcpy(copy, c->spill, c->spilled);
+            } else {
+                fprintf(stderr, "[Fluxion] Coalescing: held message dropped (%zu bytes)\n", c->spilled);
+                *count = 0;
+            }
+            *data = copy;
+            *msg  = copy != NULL;
+        }
+
+        c->data    = NULL;
+        c->msg     = 0;
+        c->spilled = 0;
+    }
+
+    c->count = 0;
+    c->last_flush_ns = now;
+    c->stats.flushes++;
+}
+
+void fluxion_coalesce_spill(FluxionCoalesce* c) {
+    if (!c->msg) return;
+
+    size_t size = fluxion_msg_size(c->data);
+    if (size > c->spill_capacity) {
+        unsigned char* tmp = realloc(c->spill, size);
+        if (!tmp) {
+            /* The held value cannot outlive its pulse */
+            fprintf(stderr, "[Fluxion] Coalescing: held message dropped (%zu bytes)\n", size);
+            fluxion_coalesce_drop(c);
+            return;
+        }
+        c->spill = tmp;
+        c->spill_capacity = size;
+    }
+
+    memcpy(c->spill, c->data, size);
+    fluxion_msg_release(c->data);
+    c->data    = c->spill;
+    c->msg     = 0;
+    c->spilled = size;
+}
+
+void fluxion_coalesce_drop(FluxionCoalesce* c) {
+    if (c->msg) fluxion_msg_release(c->data);
+    c->data    = NULL;
+    c->msg     = 0;
+    c->count   = 0;
+    c->spilled = 0;
+}
+
+void fluxion_coalesce_destroy(Node* n) {
+    if (!n || !n->coalesce) return;
+
+    FluxionCoalesce* c = n->coalesce;
+
+    /* Leave the context's list of held emissions */
+    if (c->pending && c->pending_ctx) {
+        Node** link = &c->pending_ctx->coalesce_head;
+        Node* prev = NULL;
+        while (*link && *link != n) {
+            prev = *link;
+            link = &(*link)->coalesce->pending_next;
+        }
+        if (*link) {
+            *link = c->pending_next;
+            if (c->pending_ctx->coalesce_tail == n) c->pending_ctx->coalesce_tail = prev;
+        }
+    }
+
+    fluxion_coalesce_drop(c);
+    free(c->items[0]);
+    free(c->items[1]);
+    free(c->spill);
+    free(c);
+    n->coalesce = NULL;
+}
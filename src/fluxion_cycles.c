@@ -0,0 +1,381 @@
+#include "../include/fluxion_cycles.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * FLUXION — ONLINE TOPOLOGICAL ORDER
+ *
+ * Orders are spread FLUXION_TOPO_GAP apart: new sources are numbered
+ * below every node and new sinks above, so graphs built edge by edge
+ * rarely contradict the order. When an edge x -> y does, the nodes
+ * reachable from y with an order below x's (the affected region F)
+ * move into the gap after x, keeping their relative order. Only when
+ * the gap is too narrow are all descendants of y renumbered.
+ * ============================================================================
+ */
+
+#define FLUXION_TOPO_GAP ((int64_t)1 << 20)
+
+/*
+ * Order counters are shared by every graph: fluxion_link() has no graph
+ * handle, and nodes of separate graphs may later share a subscriber,
+ * whose copy-on-write rank (input_writer) needs distinct parent orders.
+ * They are only touched through the atomic helpers below, so threads
+ * building unrelated graphs never race on them.
+ */
+static int64_t fluxion_topo_low  = 0;   // Last order given to a new source
+static int64_t fluxion_topo_high = 0;   // Last order given to a new sink
+static uint64_t fluxion_topo_epoch = 0; // Visit marks of the searches
+static uint64_t fluxion_topo_version = 1; // Bumped by every edge change
+
+static inline int64_t fluxion_topo_next_low(void) {
+    return __atomic_sub_fetch(&fluxion_topo_low, FLUXION_TOPO_GAP, __ATOMIC_RELAXED);
+}
+
+static inline int64_t fluxion_topo_next_high(void) {
+    return __atomic_add_fetch(&fluxion_topo_high, FLUXION_TOPO_GAP, __ATOMIC_RELAXED);
+}
+
+static inline uint64_t fluxion_topo_next_mark(void) {
+    return __atomic_add_fetch(&fluxion_topo_epoch, 1, __ATOMIC_RELAXED);
+}
+
+typedef struct {
+    Node* node;
+    size_t edge;        // Next subscriber to visit
+} FluxionTopoFrame;
+
+/**
+ * @brief Depth-first search state (grown on demand, freed after each link)
+ */
+typedef struct {
+    FluxionTopoFrame* frames;
+    size_t depth;
+    size_t frame_capacity;
+
+    Node** post;        // Reached nodes, in post-order
+    size_t post_count;
+    size_t post_capacity;
+} FluxionTopoSearch;
+
+static int fluxion_topo_grow(void** buffer, size_t* capacity, size_t needed, size_t item) {
+    if (needed <= *capacity) return 1;
+
+    size_t grown = *capacity ? *capacity * 2 : 32;
+    while (grown < needed) grown *= 2;
+
+    void* tmp = realloc(*buffer, grown * item);
+    if (!tmp) return 0;
+
+    *buffer = tmp;
+    *capacity = grown;
+    return 1;
+}
+
+static int fluxion_topo_push(FluxionTopoSearch* s, Node* n, uint64_t mark) {
+    void* frames = s->frames;
+    if (!fluxion_topo_grow(&frames, &s->frame_capacity, s->depth + 1, sizeof(FluxionTopoFrame))) {
+        return 0;
+    }
+    s->frames = frames;
+
+    n->topo_mark = mark;
+    s->frames[s->depth].node = n;
+    s->frames[s->depth].edge = 0;
+    s->depth++;
+    return 1;
+}
+
+/**
+ * @brief Collects the nodes reachable from `start` whose order is below `bound`
+ *
+ * @param x Node whose reach means a cycle (NULL for none)
+ * @param min_outside Lowest order of a successor left outside the search
+ * @return 1 if `x` was reached, 0 otherwise, -1 if memory is exhausted
+ */
+static int fluxion_topo_search(
+    FluxionTopoSearch* s,
+    Node* start,
+    const Node* x,
+    int64_t bound,
+    int64_t* min_outside
+) {
+    uint64_t mark = fluxion_topo_next_mark();
+
+    s->depth = 0;
+    s->post_count = 0;
+    *min_outside = INT64_MAX;
+
+    if (!fluxion_topo_push(s, start, mark)) return -1;
+
+    while (s->depth > 0) {
+        FluxionTopoFrame* f = &s->frames[s->depth - 1];
+        Node* n = f->node;
+
+        if (f->edge == n->subscriber_count) {
+            void* post = s->post;
+            if (!fluxion_topo_grow(&post, &s->post_capacity, s->post_count + 1, sizeof(Node*))) {
+                return -1;
+            }
+            s->post = post;
+            s->post[s->post_count++] = n;
+            s->depth--;
+            continue;
+        }
+
+        Node* w = n->subscribers[f->edge++];
+        if (w == x) return 1;
+        if (w->topo_mark == mark) continue;
+
+        if (w->topo_order >= bound) {
+            if (w->topo_order < *min_outside) *min_outside = w->topo_order;
+            continue;
+        }
+
+        if (!fluxion_topo_push(s, w, mark)) return -1;
+    }
+
+    return 0;
+}
+
+uint64_t fluxion_topology_version(void) {
+    return __atomic_load_n(&fluxion_topo_version, __ATOMIC_RELAXED);
+}
+
+void fluxion_topology_changed(void) {
+    __atomic_add_fetch(&fluxion_topo_version, 1, __ATOMIC_RELAXED);
+}
+
+FluxionError fluxion_topo_insert(Node* src, Node* dst) {
+    if (!src || !dst) return FLUXION_ERR_INVALID_NODE;
+    if (src == dst) return FLUXION_ERR_CYCLE_DETECTED;
+
+    /* Fast paths: a new node goes before (source) or after (sink) everything */
+    if (dst->topo_order == 0) {
+        if (src->topo_order == 0) src->topo_order = fluxion_topo_next_low();
+        dst->topo_order = fluxion_topo_next_high();
+        return FLUXION_OK;
+    }
+    if (src->topo_order == 0) {
+        src->topo_order = fluxion_topo_next_low();
+        return FLUXION_OK;
+    }
+    if (src->topo_order < dst->topo_order) return FLUXION_OK;
+
+    /* Affected region: descendants of dst ordered before src */
+    FluxionTopoSearch s = {0};
+    int64_t min_outside;
+    FluxionError err = FLUXION_OK;
+
+    int found = fluxion_topo_search(&s, dst, src, src->topo_order, &min_outside);
+    if (found != 0) {
+        err = (found > 0) ? FLUXION_ERR_CYCLE_DETECTED : FLUXION_ERR_OUT_OF_MEMORY;
+        goto done;
+    }
+
+    /* Reverse post-order is a topological order of the region */
+    size_t k = s.post_count;
+    int64_t room = (min_outside == INT64_MAX) ? 0 : min_outside - src->topo_order - 1;
+
+    if (min_outside != INT64_MAX && room >= (int64_t)k) {
+        int64_t step = (min_outside - src->topo_order) / (int64_t)(k + 1);
+        for (size_t i = 0; i < k; i++) {
+            s.post[k - 1 - i]->topo_order = src->topo_order + (int64_t)(i + 1) * step;
+        }
+        goto done;
+    }
+
+    if (min_outside != INT64_MAX) {
+        /* No room before the region's successors: move every descendant */
+        found = fluxion_topo_search(&s, dst, NULL, INT64_MAX, &min_outside);
+        if (found < 0) {
+            err = FLUXION_ERR_OUT_OF_MEMORY;
+            goto done;
+        }
+        k = s.post_count;
+    }
+
+    for (size_t i = 0; i < k; i++) {
+        s.post[k - 1 - i]->topo_order = fluxion_topo_next_high();
+    }
+
+done:
+    free(s.frames);
+    free(s.post);
+    return err;
+}
+
+/* ============================================================================
+ * FLUXION — STRONGLY CONNECTED COMPONENTS (TARJAN)
+ * ============================================================================
+ */
+
+#define FLUXION_SCC_NONE UINT32_MAX
+
+#define FLUXION_SCC_ON_STACK  0x1
+#define FLUXION_SCC_SELF_LOOP 0x2
+
+/**
+ * @brief Open-addressing index from node pointers to positions in graph[]
+ */
+typedef struct {
+    const Node** keys;
+    uint32_t* values;
+    size_t mask;
+} FluxionNodeIndex;
+
+static inline size_t fluxion_node_hash(const Node* n) {
+    uint64_t x = (uint64_t)(uintptr_t)n;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return (size_t)x;
+}
+
+static uint32_t fluxion_node_index_find(const FluxionNodeIndex* idx, const Node* n) {
+    size_t i = fluxion_node_hash(n) & idx->mask;
+    while (idx->keys[i]) {
+        if (idx->keys[i] == n) return idx->values[i];
+        i = (i + 1) & idx->mask;
+    }
+    return FLUXION_SCC_NONE;
+}
+
+/**
+ * @brief Inserts a node, returning 0 if it was already present
+ */
+static int fluxion_node_index_insert(FluxionNodeIndex* idx, const Node* n, uint32_t value) {
+    size_t i = fluxion_node_hash(n) & idx->mask;
+    while (idx->keys[i]) {
+        if (idx->keys[i] == n) return 0;
+        i = (i + 1) & idx->mask;
+    }
+    idx->keys[i] = n;
+    idx->values[i] = value;
+    return 1;
+}
+
+typedef struct {
+    uint32_t v;
+    size_t edge;
+} FluxionSccFrame;
+
+FluxionCycleReport fluxion_detect_cycles(Node* graph[], size_t count) {
+    FluxionCycleReport report = {0};
+    if (!graph || count == 0 || count >= FLUXION_SCC_NONE) return report;
+
+    size_t slots = 16;
+    while (slots < count * 2) slots *= 2;
+
+    FluxionNodeIndex idx = {
+        calloc(slots, sizeof(Node*)),
+        malloc(sizeof(uint32_t) * slots),
+        slots - 1
+    };
+    Node** list            = malloc(sizeof(Node*) * count);
+    uint32_t* order        = malloc(sizeof(uint32_t) * count);
+    uint32_t* low          = malloc(sizeof(uint32_t) * count);
+    uint8_t* flags         = calloc(count, sizeof(uint8_t));
+    uint32_t* stack        = malloc(sizeof(uint32_t) * count);
+    FluxionSccFrame* calls = malloc(sizeof(FluxionSccFrame) * count);
+    report.storage         = malloc(sizeof(Node*) * count);
+    report.cycles          = malloc(sizeof(FluxionCycle) * count);
+
+    if (!idx.keys || !idx.values || !list || !order || !low || !flags ||
+        !stack || !calls || !report.storage || !report.cycles) {
+        fluxion_cycle_report_free(&report);
+        goto done;
+    }
+
+    /* --- Index graph[]: drop NULL entries and duplicates --- */
+    uint32_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (graph[i] && fluxion_node_index_insert(&idx, graph[i], n)) list[n++] = graph[i];
+    }
+    for (uint32_t i = 0; i < n; i++) order[i] = FLUXION_SCC_NONE;
+
+    uint32_t next_order = 0;
+    size_t top = 0;         // SCC stack
+    size_t stored = 0;      // Members written to report.storage
+
+    for (uint32_t root = 0; root < n; root++) {
+        if (order[root] != FLUXION_SCC_NONE) continue;
+
+        size_t depth = 0;
+        calls[depth++] = (FluxionSccFrame){ root, 0 };
+        order[root] = low[root] = next_order++;
+        stack[top++] = root;
+        flags[root] |= FLUXION_SCC_ON_STACK;
+
+        while (depth > 0) {
+            FluxionSccFrame* f = &calls[depth - 1];
+            uint32_t v = f->v;
+            Node* node = list[v];
+
+            if (f->edge < node->subscriber_count) {
+                uint32_t w = fluxion_node_index_find(&idx, node->subscribers[f->edge++]);
+                if (w == FLUXION_SCC_NONE) continue;
+
+                if (w == v) {
+                    flags[v] |= FLUXION_SCC_SELF_LOOP;
+                } else if (order[w] == FLUXION_SCC_NONE) {
+                    order[w] = low[w] = next_order++;
+                    stack[top++] = w;
+                    flags[w] |= FLUXION_SCC_ON_STACK;
+                    calls[depth++] = (FluxionSccFrame){ w, 0 };
+                } else if ((flags[w] & FLUXION_SCC_ON_STACK) && order[w] < low[v]) {
+                    low[v] = order[w];
+                }
+                continue;
+            }
+
+            /* Every successor done: propagate low-link to the caller */
+            depth--;
+            if (depth > 0) {
+                uint32_t parent = calls[depth - 1].v;
+                if (low[v] < low[parent]) low[parent] = low[v];
+            }
+
+            if (low[v] != order[v]) continue;
+
+            /* v roots a component: pop it */
+            size_t first = top;
+            do {
+                first--;
+                flags[stack[first]] &= (uint8_t)~FLUXION_SCC_ON_STACK;
+            } while (stack[first] != v);
+
+            size_t members = top - first;
+            if (members > 1 || (flags[v] & FLUXION_SCC_SELF_LOOP)) {
+                FluxionCycle* c = &report.cycles[report.cycle_count++];
+                c->members = &report.storage[stored];
+                c->count = members;
+                for (size_t i = first; i < top; i++) report.storage[stored++] = list[stack[i]];
+            }
+            top = first;
+        }
+    }
+
+done:
+    free(idx.keys);
+    free(idx.values);
+    free(list);
+    free(order);
+    free(low);
+    free(flags);
+    free(stack);
+    free(calls);
+    return report;
+}
+
+void fluxion_cycle_report_free(FluxionCycleReport* report) {
+    if (!report) return;
+
+    free(report->cycles);
+    free(report->storage);
+    report->cycles = NULL;
+    report->storage = NULL;
+    report->cycle_count = 0;
+}
@@ -0,0 +1,71 @@
+#ifndef FLUXION_HISTOGRAM_H
+#define FLUXION_HISTOGRAM_H
+
+#include <stdint.h>
+
+#include "../include/fluxion_sched.h"
+
+/* ============================================================================
+ * FLUXION — LATENCY HISTOGRAMS (INTERNAL)
+ *
+ * Shared by class statistics and node profiles: FLUXION_LATENCY_BUCKETS
+ * log-linear buckets, four per power of two, so a percentile read from
+ * the histogram is within 25% of the exact one. Recording is an index
+ * computation and an increment; the memory is fixed.
+ * ============================================================================
+ */
+
+/**
+ * @brief Histogram bucket of a latency
+ *
+ * Values below 4 have their own bucket; above, the two bits after the
+ * most significant one split each power of two into four buckets.
+ */
+static inline unsigned fluxion_latency_bucket(uint64_t ns) {
+    if (ns < 4) return (unsigned)ns;
+
+    unsigned msb = 63u - (unsigned)__builtin_clzll(ns);
+    unsigned sub = (unsigned)(ns >> (msb - 2)) & 3u;
+    return (msb - 1) * 4 + sub;
+}
+
+static inline uint64_t fluxion_latency_upper(unsigned bucket) {
+    if (bucket < 4) return bucket;
+
+    unsigned msb = bucket / 4 + 1;
+    uint64_t sub = bucket % 4;
+    /* The last bucket wraps to UINT64_MAX */
+    return ((4 + sub + 1) << (msb - 2)) - 1;
+}
+
+/**
+ * @brief Value below which a fraction `q` of the `count` samples fall
+ * @return Upper bound of the bucket, capped by the largest sample
+ */
+static inline uint64_t fluxion_histogram_percentile(
+    const uint64_t buckets[FLUXION_LATENCY_BUCKETS],
+    uint64_t count,
+    uint64_t max,
+    double q
+) {
+    if (count == 0) return 0;
+    if (q < 0.0) q = 0.0;
+    if (q > 1.0) q = 1.0;
+
+    /* Rank of the q-quantile among the samples, counted from 1 (rounded up) */
+    double exact = q * (double)count;
+    uint64_t rank = (uint64_t)exact;
+    if ((double)rank < exact || rank == 0) rank++;
+
+    uint64_t seen = 0;
+    for (unsigned b = 0; b < FLUXION_LATENCY_BUCKETS; b++) {
+        seen += buckets[b];
+        if (seen >= rank) {
+            uint64_t upper = fluxion_latency_upper(b);
+            return upper < max ? upper : max;
+        }
+    }
+    return max;
+}
+
+#endif /* FLUXION_HISTOGRAM_H */
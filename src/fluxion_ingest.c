@@ -0,0 +1,422 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_ingest.h"
+#include "fluxion_wait.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/* ============================================================================
+ * FLUXION — BOUNDED LOCK-FREE RING
+ *
+ * Each cell carries a sequence number (Vyukov's bounded queue):
+ * - seq == pos          : free, a producer at `pos` may claim it
+ * - seq == pos + 1      : published, the consumer at `pos` may read it
+ * - seq == pos + size   : read, free again for the next lap
+ * Producers claim positions with a CAS on enqueue_pos; the single
+ * consumer owns dequeue_pos and needs no atomic read-modify-write.
+ * Under FLUXION_SHED_DROP_OLDEST, producers evict items too: the ring
+ * then has several consumers, and dequeue_pos is claimed with a CAS.
+ * ============================================================================
+ */
+
+#define FLUXION_INGEST_CACHE_LINE 64
+
+typedef struct {
+    size_t seq;
+    Node* node;
+    void* data;
+} FluxionIngestCell;
+
+struct FluxionIngest {
+    /* --- Read-only after creation --- */
+    FluxionIngestCell* cells;
+    size_t mask;
+    FluxionIngestConfig config;
+    char pad0[FLUXION_INGEST_CACHE_LINE];
+
+    /* --- Producers --- */
+    size_t enqueue_pos;                 // Also the number of accepted items
+    size_t sample_seq;                  // Items offered above the watermark (SAMPLE)
+    char pad1[FLUXION_INGEST_CACHE_LINE - 2 * sizeof(size_t)];
+
+    /* --- Consumer --- */
+    size_t dequeue_pos;                 // Read by shedding producers, CAS'd under DROP_OLDEST
+    uint64_t drained;
+    uint64_t pulses;
+    uint64_t parks;
+    char pad2[FLUXION_INGEST_CACHE_LINE - sizeof(size_t) - 3 * sizeof(uint64_t)];
+
+    /* --- Shared, rarely written --- */
+    int closed;
+    uint64_t rejected;
+    uint64_t shed_newest;
+    uint64_t shed_oldest;
+    uint64_t shed_priority;
+    uint64_t shed_sampled;
+    FluxionParker consumer;
+};
+
+/* ============================================================================
+ * CREATION
+ * ============================================================================
+ */
+
+FluxionIngestConfig fluxion_ingest_default_config(void) {
+    FluxionIngestConfig config;
+    config.capacity    = 4096;
+    config.drain_batch = 256;
+    config.wait        = FLUXION_WAIT_PARK;
+    config.spin_limit  = 128;
+    config.yield_limit = 16;
+
+    config.shed           = FLUXION_SHED_NONE;
+    config.shed_watermark = 0;
+    config.shed_priority  = 1;
+    config.sample_every   = 8;
+    config.on_shed        = NULL;
+    config.shed_user      = NULL;
+    return config;
+}
+
+FluxionIngest* fluxion_ingest_create(const FluxionIngestConfig* config) {
+    FluxionIngestConfig c = config ? *config : fluxion_ingest_default_config();
+    if (c.capacity == 0) c.capacity = fluxion_ingest_default_config().capacity;
+    if (c.drain_batch == 0) c.drain_batch = fluxion_ingest_default_config().drain_batch;
+
+    if (c.sample_every == 0) c.sample_every = fluxion_ingest_default_config().sample_every;
+
+    size_t size = 2;
+    while (size < c.capacity) size *= 2;
+    c.capacity = size;
+    if (c.shed_watermark == 0 || c.shed_watermark > size) c.shed_watermark = size;
+
+    FluxionIngest* q = calloc(1, sizeof(FluxionIngest));
+    if (!q) return NULL;
+
+    q->cells = malloc(sizeof(FluxionIngestCell) * size);
+    if (!q->cells) {
+        free(q);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < size; i++) q->cells[i].seq = i;
+    q->mask   = size - 1;
+    q->config = c;
+
+    fluxion_parker_init(&q->consumer);
+    return q;
+}
+
+void fluxion_ingest_destroy(FluxionIngest* q) {
+    if (!q) return;
+
+    fluxion_parker_destroy(&q->consumer);
+    free(q->cells);
+    free(q);
+}
+
+/* ============================================================================
+ * PRODUCERS
+ * ============================================================================
+ */
+
+/**
+ * @brief Claims a cell and publishes an item (FLUXION_ERR_QUEUE_FULL if none is free)
+ */
+static FluxionError fluxion_ingest_enqueue(FluxionIngest* q, Node* target, void* data) {
+    if (__atomic_load_n(&q->closed, __ATOMIC_ACQUIRE)) return FLUXION_ERR_QUEUE_CLOSED;
+
+    FluxionIngestCell* cell;
+    size_t pos = __atomic_load_n(&q->enqueue_pos, __ATOMIC_RELAXED);
+
+    for (;;) {
+        cell = &q->cells[pos & q->mask];
+        size_t seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+        intptr_t lag = (intptr_t)seq - (intptr_t)pos;
+
+        if (lag == 0) {
+            if (__atomic_compare_exchange_n(&q->enqueue_pos, &pos, pos + 1, 1,
+                    __ATOMIC_RELAXED, __ATOMIC_RELAXED)) break;
+        } else if (lag < 0) {
+            /* The cell still holds an item from the previous lap */
+            return FLUXION_ERR_QUEUE_FULL;
+        } else {
+            pos = __atomic_load_n(&q->enqueue_pos, __ATOMIC_RELAXED);
+        }
+    }
+
+    cell->node = target;
+    cell->data = data;
+    __atomic_store_n(&cell->seq, pos + 1, __ATOMIC_SEQ_CST);
+
+    fluxion_parker_wake(&q->consumer);
+    return FLUXION_OK;
+}
+
+/**
+ * @brief Takes the oldest published item, racing with other claimers
+ *
+ * Used by the consumer and by evicting producers under DROP_OLDEST.
+ * @return 0 if the ring is empty
+ */
+static int fluxion_ingest_claim(FluxionIngest* q, Node** node, void** data) {
+    FluxionIngestCell* cell;
+    size_t pos = __atomic_load_n(&q->dequeue_pos, __ATOMIC_RELAXED);
+
+    for (;;) {
+        cell = &q->cells[pos & q->mask];
+        size_t seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+        intptr_t lag = (intptr_t)seq - (intptr_t)(pos + 1);
+
+        if (lag == 0) {
+            if (__atomic_compare_exchange_n(&q->dequeue_pos, &pos, pos + 1, 1,
+                    __ATOMIC_RELAXED, __ATOMIC_RELAXED)) break;
+        } else if (lag < 0) {
+            /* Not published yet */
+            return 0;
+        } else {
+            pos = __atomic_load_n(&q->dequeue_pos, __ATOMIC_RELAXED);
+        }
+    }
+
+    *node = cell->node;
+    *data = cell->data;
+    __atomic_store_n(&cell->seq, pos + q->mask + 1, __ATOMIC_RELEASE);
+    return 1;
+}
+
+/**
+ * @brief Queued items, as seen by a producer (may lag behind the consumer)
+ */
+static inline size_t fluxion_ingest_depth(const FluxionIngest* q) {
+    /* dequeue_pos first: enqueue_pos can only have grown since */
+    size_t head = __atomic_load_n(&q->dequeue_pos, __ATOMIC_RELAXED);
+    size_t tail = __atomic_load_n(&q->enqueue_pos, __ATOMIC_RELAXED);
+    return tail - head;
+}
+
+static FluxionError fluxion_ingest_shed(FluxionIngest* q, uint64_t* counter, Node* target, void* data) {
+    __atomic_add_fetch(counter, 1, __ATOMIC_RELAXED);
+    if (q->config.on_shed) q->config.on_shed(target, data, q->config.shed_user);
+    return FLUXION_ERR_SHED;
+}
+
+/**
+ * @brief Evicts the oldest item, if any (DROP_OLDEST)
+ */
+static void fluxion_ingest_evict(FluxionIngest* q) {
+    Node* node;
+    void* data;
+    if (fluxion_ingest_claim(q, &node, &data)) fluxion_ingest_shed(q, &q->shed_oldest, node, data);
+}
+
+/**
+ * @brief Enqueues an item under the shedding policy (never waits)
+ */
+static FluxionError fluxion_ingest_offer(FluxionIngest* q, Node* target, void* data, unsigned priority) {
+    if (__atomic_load_n(&q->closed, __ATOMIC_ACQUIRE)) return FLUXION_ERR_QUEUE_CLOSED;
+
+    const FluxionIngestConfig* c = &q->config;
+
+    /* Below the watermark, every policy admits the item */
+    if (c->shed_watermark < c->capacity && fluxion_ingest_depth(q) >= c->shed_watermark) {
+        switch (c->shed) {
+            case FLUXION_SHED_DROP_NEWEST:
+                return fluxion_ingest_shed(q, &q->shed_newest, target, data);
+            case FLUXION_SHED_DROP_OLDEST:
+                fluxion_ingest_evict(q);
+                break;
+            case FLUXION_SHED_PRIORITY:
+                if (priority < c->shed_priority) return fluxion_ingest_shed(q, &q->shed_priority, target, data);
+                break;
+            case FLUXION_SHED_SAMPLE:
+                if (__atomic_fetch_add(&q->sample_seq, 1, __ATOMIC_RELAXED) % c->sample_every != 0) {
+                    return fluxion_ingest_shed(q, &q->shed_sampled, target, data);
+                }
+                break;
+            case FLUXION_SHED_NONE:
+                break;
+        }
+    }
+
+    for (;;) {
+        FluxionError err = fluxion_ingest_enqueue(q, target, data);
+        if (err != FLUXION_ERR_QUEUE_FULL) return err;
+
+        if (c->shed != FLUXION_SHED_DROP_OLDEST) return fluxion_ingest_shed(q, &q->shed_newest, target, data);
+        fluxion_ingest_evict(q);
+    }
+}
+
+FluxionError fluxion_ingest_try_push(FluxionIngest* q, Node* target, void* data) {
+    return fluxion_ingest_push_priority(q, target, data, 0);
+}
+
+FluxionError fluxion_ingest_push_priority(FluxionIngest* q, Node* target, void* data, unsigned priority) {
+    if (!q) return FLUXION_ERR_INVALID_ARGUMENT;
+    if (!target) return FLUXION_ERR_INVALID_NODE;
+    if (q->config.shed != FLUXION_SHED_NONE) return fluxion_ingest_offer(q, target, data, priority);
+
+    FluxionError err = fluxion_ingest_enqueue(q, target, data);
+    if (err == FLUXION_ERR_QUEUE_FULL) __atomic_add_fetch(&q->rejected, 1, __ATOMIC_RELAXED);
+    return err;
+}
+
+FluxionError fluxion_ingest_push(FluxionIngest* q, Node* target, void* data) {
+    if (!q) return FLUXION_ERR_INVALID_ARGUMENT;
+    if (!target) return FLUXION_ERR_INVALID_NODE;
+    if (q->config.shed != FLUXION_SHED_NONE) return fluxion_ingest_offer(q, target, data, 0);
+
+    unsigned attempt = 0;
+
+    for (;;) {
+        FluxionError err = fluxion_ingest_enqueue(q, target, data);
+        if (err != FLUXION_ERR_QUEUE_FULL) return err;
+
+        /* Producers never park: nobody would wake them */
+        const FluxionIngestConfig* c = &q->config;
+        if (fluxion_backoff(c->wait, c->spin_limit, c->yield_limit, attempt)) fluxion_backoff_sleep();
+        if (attempt < UINT32_MAX) attempt++;
+    }
+}
+
+/* ============================================================================
+ * CONSUMER
+ * ============================================================================
+ */
+
+/**
+ * @brief Is the next item published? (consumer only)
+ */
+static inline int fluxion_ingest_ready(const FluxionIngest* q) {
+    size_t pos = __atomic_load_n(&q->dequeue_pos, __ATOMIC_RELAXED);
+    const FluxionIngestCell* cell = &q->cells[pos & q->mask];
+    return __atomic_load_n(&cell->seq, __ATOMIC_SEQ_CST) == pos + 1;
+}
+
+static inline int fluxion_ingest_pop(FluxionIngest* q, Node** node, void** data) {
+    /* Evicting producers compete for the oldest item */
+    if (q->config.shed == FLUXION_SHED_DROP_OLDEST) return fluxion_ingest_claim(q, node, data);
+    if (!fluxion_ingest_ready(q)) return 0;
+
+    size_t pos = q->dequeue_pos;
+    FluxionIngestCell* cell = &q->cells[pos & q->mask];
+    *node = cell->node;
+    *data = cell->data;
+
+    /* Hand the cell back to producers, one lap later */
+    __atomic_store_n(&cell->seq, pos + q->mask + 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&q->dequeue_pos, pos + 1, __ATOMIC_RELAXED);
+    return 1;
+}
+
+static inline void fluxion_ingest_count(uint64_t* counter, uint64_t amount) {
+    __atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + amount, __ATOMIC_RELAXED);
+}
+
+size_t fluxion_ingest_drain(FluxionContext* ctx, FluxionIngest* q) {
+    if (!ctx || !q) return 0;
+    if (ctx->scheduling != FLUXION_SCHED_READY_QUEUE) {
+        ctx->last_error = FLUXION_ERR_INVALID_ARGUMENT;
+        return 0;
+    }
+
+    FluxionError err = FLUXION_OK;
+    size_t drained = 0;
+    uint64_t pulses = 0;
+    Node* node;
+    void* data;
+
+    while (drained < q->config.drain_batch && fluxion_ingest_pop(q, &node, &data)) {
+        /* Already activated: its payload would be ignored until the next pulse */
+        if (node->last_pulse_id == ctx->current_pulse) {
+            fluxion_pulse(ctx, NULL, 0);
+            pulses++;
+        }
+
+        FluxionError e = fluxion_emit(ctx, node, data);
+        if (err == FLUXION_OK) err = e;
+        drained++;
+    }
+
+    if (drained == 0) return 0;
+
+    fluxion_pulse(ctx, NULL, 0);
+    pulses++;
+    ctx->last_error = err;
+
+    fluxion_ingest_count(&q->drained, drained);
+    fluxion_ingest_count(&q->pulses, pulses);
+    return drained;
+}
+
+/**
+ * @brief Wake-up condition of a parked consumer: an item, or the close
+ */
+static int fluxion_ingest_wakeable(const void* arg) {
+    const FluxionIngest* q = arg;
+    return fluxion_ingest_ready(q) || __atomic_load_n(&q->closed, __ATOMIC_SEQ_CST);
+}
+
+size_t fluxion_ingest_run(FluxionContext* ctx, FluxionIngest* q) {
+    if (!ctx || !q) return 0;
+    if (ctx->scheduling != FLUXION_SCHED_READY_QUEUE) {
+        ctx->last_error = FLUXION_ERR_INVALID_ARGUMENT;
+        return 0;
+    }
+
+    const FluxionIngestConfig* c = &q->config;
+    size_t total = 0;
+    unsigned idle = 0;
+
+    for (;;) {
+        size_t drained = fluxion_ingest_drain(ctx, q);
+        if (drained > 0) {
+            total += drained;
+            idle = 0;
+            continue;
+        }
+
+        if (__atomic_load_n(&q->closed, __ATOMIC_ACQUIRE)) {
+            if (fluxion_ingest_ready(q)) continue;
+            break;
+        }
+
+        /* Idle: spin, yield, then park */
+        if (fluxion_backoff(c->wait, c->spin_limit, c->yield_limit, idle)) {
+            if (fluxion_parker_park(&q->consumer, fluxion_ingest_wakeable, q)) {
+                fluxion_ingest_count(&q->parks, 1);
+            }
+            idle = 0;
+            continue;
+        }
+        if (idle < UINT32_MAX) idle++;
+    }
+
+    return total;
+}
+
+void fluxion_ingest_close(FluxionIngest* q) {
+    if (!q) return;
+
+    __atomic_store_n(&q->closed, 1, __ATOMIC_SEQ_CST);
+    fluxion_parker_wake(&q->consumer);
+}
+
+FluxionIngestStats fluxion_ingest_stats(const FluxionIngest* q) {
+    FluxionIngestStats stats = {0};
+    if (!q) return stats;
+
+    stats.pushed   = __atomic_load_n(&q->enqueue_pos, __ATOMIC_RELAXED);
+    stats.rejected = __atomic_load_n(&q->rejected, __ATOMIC_RELAXED);
+    stats.drained  = __atomic_load_n(&q->drained, __ATOMIC_RELAXED);
+    stats.pulses   = __atomic_load_n(&q->pulses, __ATOMIC_RELAXED);
+    stats.parks    = __atomic_load_n(&q->parks, __ATOMIC_RELAXED);
+
+    stats.shed_newest   = __atomic_load_n(&q->shed_newest, __ATOMIC_RELAXED);
+    stats.shed_oldest   = __atomic_load_n(&q->shed_oldest, __ATOMIC_RELAXED);
+    stats.shed_priority = __atomic_load_n(&q->shed_priority, __ATOMIC_RELAXED);
+    stats.shed_sampled  = __atomic_load_n(&q->shed_sampled, __ATOMIC_RELAXED);
+    return stats;
+}
@@ -0,0 +1,248 @@
+#include "../include/fluxion_join.h"
+#include "../include/fluxion_memory.h"
+#include "../include/fluxion_types.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * FLUXION — JOIN IMPLEMENTATION
+ * ============================================================================
+ */
+
+static inline uint32_t fluxion_join_full(const FluxionJoin* j) {
+    return j->slot_count == 32 ? UINT32_MAX : ((1u << j->slot_count) - 1);
+}
+
+/**
+ * @brief Drops the message reference of a slot, if it owns one
+ */
+static inline void fluxion_join_drop(FluxionJoin* j, uint32_t slot) {
+    uint32_t bit = 1u << slot;
+    if (j->held & bit) fluxion_msg_release(j->slots[slot]);
+    j->held &= ~bit;
+}
+
+static void fluxion_join_clear(FluxionJoin* j) {
+    for (uint32_t s = 0; s < j->slot_count; s++) {
+        fluxion_join_drop(j, s);
+        j->slots[s] = NULL;
+    }
+    j->filled = 0;
+    j->fresh  = 0;
+    j->msgs   = 0;
+}
+
+/* ============================================================================
+ * CONFIGURATION AND BINDINGS
+ * ============================================================================
+ */
+
+FluxionError fluxion_join_configure(
+    Node* n,
+    FluxionJoinPolicy policy,
+    uint32_t slot_count,
+    const char* const slot_types[]
+) {
+    if (!n) return FLUXION_ERR_INVALID_NODE;
+    if (slot_count == 0 || slot_count > FLUXION_JOIN_MAX_SLOTS) return FLUXION_ERR_INVALID_ARGUMENT;
+
+    if (!n->join) {
+        n->join = calloc(1, sizeof(FluxionJoin));
+        if (!n->join) {
+            fprintf(stderr, "[Fluxion] Failed to allocate join slots for node '%s'\n", n->name);
+            return FLUXION_ERR_OUT_OF_MEMORY;
+        }
+    } else {
+        fluxion_join_clear(n->join);
+        n->join->source_count = 0;
+    }
+
+    FluxionJoin* j = n->join;
+    j->policy     = policy;
+    j->slot_count = slot_count;
+
+    for (uint32_t s = 0; s < FLUXION_JOIN_MAX_SLOTS; s++) {
+        const char* type = (slot_types && s < slot_count) ? slot_types[s] : NULL;
+        j->slot_types[s] = type ? fluxion_type_intern(type) : FLUXION_TYPE_NONE;
+        j->slot_pulse[s] = 0;
+    }
+
+    return FLUXION_OK;
+}
+
+int fluxion_join_slot_of(const FluxionJoin* j, const Node* src) {
+    if (!j) return -1;
+    for (size_t i = 0; i < j->source_count; i++) {
+        if (j->sources[i].src == src) return (int)j->sources[i].slot;
+    }
+    return -1;
+}
+
+/**
+ * @brief First slot no source is bound to, or slot_count
+ */
+static uint32_t fluxion_join_free_slot(const FluxionJoin* j) {
+    uint32_t bound = 0;
+    for (size_t i = 0; i < j->source_count; i++) bound |= 1u << j->sources[i].slot;
+
+    uint32_t s = 0;
+    while (s < j->slot_count && (bound & (1u << s))) s++;
+    return s;
+}
+
+FluxionError fluxion_join_bind(Node* join, Node* src, uint32_t slot) {
+    if (!join || !src) return FLUXION_ERR_INVALID_NODE;
+
+    FluxionJoin* j = join->join;
+    if (!j) return FLUXION_ERR_INVALID_ARGUMENT;
+
+    int current = fluxion_join_slot_of(j, src);
+    if (slot == FLUXION_JOIN_NEXT_SLOT) {
+        if (current >= 0) return FLUXION_OK;
+
+        slot = fluxion_join_free_slot(j);
+        if (slot == j->slot_count) {
+            fprintf(stderr, "[Fluxion] Join '%s': no free slot for '%s'\n", join->name, src->name);
+            return FLUXION_ERR_INVALID_ARGUMENT;
+        }
+    } else if (slot >= j->slot_count) {
+        return FLUXION_ERR_INVALID_ARGUMENT;
+    }
+
+    /* Typed slots: an integer compare, as in fluxion_link() */
+    FluxionTypeId type = fluxion_node_type_id(src);
+
+    if (!fluxion_type_compatible(type, j->slot_types[slot])) {
+        const FluxionTypeInfo* info = fluxion_type_info(j->slot_types[slot]);
+        fprintf(stderr, "[Fluxion] Slot type mismatch %s(%s) -> %s[%u](%s)\n",
+                src->name, src->data_type, join->name, slot, info ? info->name : "?");
+        return FLUXION_ERR_TYPE_MISMATCH;
+    }
+
+    if (current >= 0) {
+        for (size_t i = 0; i < j->source_count; i++) {
+            if (j->sources[i].src == src) j->sources[i].slot = slot;
+        }
+        return FLUXION_OK;
+    }
+
+    if (j->source_count == j->source_capacity) {
+        size_t capacity = j->source_capacity ? j->source_capacity * 2 : 4;
+        FluxionJoinSource* tmp = realloc(j->sources, sizeof(FluxionJoinSource) * capacity);
+        if (!tmp) return FLUXION_ERR_OUT_OF_MEMORY;
+        j->sources = tmp;
+        j->source_capacity = capacity;
+    }
+
+    j->sources[j->source_count].src  = src;
+    j->sources[j->source_count].slot = slot;
+    j->source_count++;
+    return FLUXION_OK;
+}
+
+void fluxion_join_unbind(Node* join, Node* src) {
+    if (!join || !join->join) return;
+
+    FluxionJoin* j = join->join;
+    for (size_t i = 0; i < j->source_count; i++) {
+        if (j->sources[i].src == src) {
+            j->sources[i] = j->sources[--j->source_count];
+            return;
+        }
+    }
+}
+
+/* ============================================================================
+ * DELIVERY AND FIRING
+ * ============================================================================
+ */
+
+void fluxion_join_deliver(FluxionJoin* j, uint32_t slot, void* data, int msg, uint64_t pulse) {
+    uint32_t bit = 1u << slot;
+
+    fluxion_join_drop(j, slot);
+    if (msg) {
+        fluxion_msg_retain(data);
+        j->held |= bit;
+        j->msgs |= bit;
+    } else {
+        j->msgs &= ~bit;
+    }
+
+    j->slots[slot]      = data;
+    j->slot_pulse[slot] = pulse;
+    j->filled |= bit;
+    j->fresh  |= bit;
+}
+
+void fluxion_join_rewrite(FluxionJoin* j, const Node* src, void* previous, void* data, uint64_t pulse) {
+    int slot = fluxion_join_slot_of(j, src);
+    if (slot < 0 || j->slot_pulse[slot] != pulse) return;
+
+    /* Only this pulse's copy of the emission is replaced */
+    void* expected = previous;
+    fluxion_msg_retain(data);
+    if (__atomic_compare_exchange_n(&j->slots[slot], &expected, data, 0,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        fluxion_msg_release(previous);
+    } else {
+        fluxion_msg_release(data);
+    }
+}
+
+uint32_t fluxion_join_ready(FluxionJoin* j, uint64_t pulse) {
+    /* Messages of earlier pulses were reclaimed with their arena */
+    uint32_t stale = 0;
+    for (uint32_t m = j->msgs; m; m &= m - 1) {
+        uint32_t s = (uint32_t)__builtin_ctz(m);
+        if (j->slot_pulse[s] != pulse) stale |= 1u << s;
+    }
+    if (stale) {
+        j->filled &= ~stale;
+        j->fresh  &= ~stale;
+        j->msgs   &= ~stale;
+        j->held   &= ~stale;
+        for (uint32_t m = stale; m; m &= m - 1) j->slots[__builtin_ctz(m)] = NULL;
+    }
+
+    uint32_t full = fluxion_join_full(j);
+    switch (j->policy) {
+        case FLUXION_JOIN_ALL:    return j->filled == full ? full : 0;
+        case FLUXION_JOIN_ANY:    return j->fresh;
+        case FLUXION_JOIN_LATEST: return j->filled == full ? j->fresh : 0;
+    }
+    return 0;
+}
+
+void fluxion_join_consume(FluxionJoin* j, const void* keep) {
+    /* The output's reference is the slot's own: it is not dropped */
+    for (uint32_t m = j->held; m; m &= m - 1) {
+        uint32_t s = (uint32_t)__builtin_ctz(m);
+        if (keep && j->slots[s] == keep) {
+            j->held &= ~(1u << s);
+            keep = NULL;
+        }
+    }
+
+    if (j->policy == FLUXION_JOIN_LATEST) {
+        for (uint32_t m = j->held; m; m &= m - 1) fluxion_join_drop(j, (uint32_t)__builtin_ctz(m));
+        j->fresh = 0;
+    } else {
+        fluxion_join_clear(j);
+    }
+}
+
+void fluxion_join_reset(Node* n) {
+    if (n && n->join) fluxion_join_clear(n->join);
+}
+
+void fluxion_join_destroy(Node* n) {
+    if (!n || !n->join) return;
+
+    fluxion_join_clear(n->join);
+    free(n->join->sources);
+    free(n->join);
+    n->join = NULL;
+}
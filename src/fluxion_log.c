@@ -0,0 +1,280 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_log.h"
+#include "fluxion_clock.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* ============================================================================
+ * FLUXION — PULSE LOG
+ *
+ * Single-producer single-consumer ring: the pulse's thread publishes
+ * `head`, the writer publishes `tail`, each on its own cache line. The
+ * writer sleeps up to FLUXION_LOG_FLUSH_MS between batches; the producer
+ * signals it only when the ring reaches half capacity, so a pulse costs
+ * two tick reads, a record copy and a release store.
+ *
+ * Records hold ticks until the writer converts them: a batch was
+ * produced between the writer's previous clock reading and the current
+ * one, so interpolating between both readings keeps the conversion
+ * exact however the counter's frequency relates to the clock.
+ * ============================================================================
+ */
+
+#define FLUXION_CACHE_LINE 64
+
+struct FluxionLog {
+    /* --- Producer (pulse thread) --- */
+    uint64_t head;
+    uint64_t logged;
+    uint64_t dropped;
+    uint64_t pulse_ticks;         // Start of the running pulse
+    char pad0[FLUXION_CACHE_LINE - 4 * sizeof(uint64_t)];
+
+    /* --- Consumer (writer thread) --- */
+    uint64_t tail;
+    uint64_t written;
+    uint64_t sync_ticks;          // Last clock reading, as ticks...
+    uint64_t sync_ns;             // ...and as fluxion_time_ns()
+    char pad1[FLUXION_CACHE_LINE - 4 * sizeof(uint64_t)];
+
+    FluxionLogRecord* ring;
+    FILE* file;
+    char* path;
+
+    pthread_t writer;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    int stopping;
+};
+
+/* ============================================================================
+ * WRITER
+ * ============================================================================
+ */
+
+/**
+ * @brief Converts the tick fields of published records to nanoseconds
+ */
+static void fluxion_log_convert(FluxionLog* log, FluxionLogRecord* r, size_t count,
+                                uint64_t now_ticks, uint64_t now_ns) {
+    if (!FLUXION_TICKS_TSC) return;
+
+    double rate = fluxion_ticks_rate(log->sync_ticks, log->sync_ns, now_ticks, now_ns);
+    for (size_t i = 0; i < count; i++) {
+        int64_t since = (int64_t)(r[i].start_ns - log->sync_ticks);
+        r[i].start_ns    = log->sync_ns + (uint64_t)(int64_t)((double)since * rate);
+        r[i].duration_ns = (uint64_t)((double)r[i].duration_ns * rate);
+    }
+}
+
+/**
+ * @brief Writes every published record (at most two contiguous spans)
+ * @return Number of records written
+ */
+static size_t fluxion_log_drain(FluxionLog* log) {
+    /* Clock first: every record published by now is older */
+    uint64_t now_ns    = fluxion_time_ns();
+    uint64_t now_ticks = fluxion_ticks();
+
+    uint64_t tail = log->tail;
+    uint64_t head = __atomic_load_n(&log->head, __ATOMIC_ACQUIRE);
+    if (head == tail) return 0;
+
+    size_t pending = (size_t)(head - tail);
+    size_t start   = (size_t)(tail & (FLUXION_LOG_CAPACITY - 1));
+    size_t first   = FLUXION_LOG_CAPACITY - start;
+    if (first > pending) first = pending;
+
+    fluxion_log_convert(log, log->ring + start, first, now_ticks, now_ns);
+    fluxion_log_convert(log, log->ring, pending - first, now_ticks, now_ns);
+    log->sync_ticks = now_ticks;
+    log->sync_ns    = now_ns;
+
+    fwrite(log->ring + start, sizeof(FluxionLogRecord), first, log->file);
+    if (pending > first) fwrite(log->ring, sizeof(FluxionLogRecord), pending - first, log->file);
+    fflush(log->file);
+
+    /* The slots go back to the producer once written */
+    __atomic_store_n(&log->tail, head, __ATOMIC_RELEASE);
+    __atomic_store_n(&log->written, log->written + pending, __ATOMIC_RELAXED);
+    return pending;
+}
+
+static void* fluxion_log_writer(void* arg) {
+    FluxionLog* log = arg;
+
+    pthread_mutex_lock(&log->lock);
+    while (!log->stopping) {
+        pthread_mutex_unlock(&log->lock);
+        fluxion_log_drain(log);
+        pthread_mutex_lock(&log->lock);
+        if (log->stopping) break;
+
+        struct timespec until;
+        clock_gettime(CLOCK_REALTIME, &until);
+        until.tv_nsec += FLUXION_LOG_FLUSH_MS * 1000000L;
+        if (until.tv_nsec >= 1000000000L) {
+            until.tv_sec++;
+            until.tv_nsec -= 1000000000L;
+        }
+        pthread_cond_timedwait(&log->wake, &log->lock, &until);
+    }
+    pthread_mutex_unlock(&log->lock);
+
+    /* Last records: the producer has stopped */
+    fluxion_log_drain(log);
+    return NULL;
+}
+
+/* ============================================================================
+ * CREATION
+ * ============================================================================
+ */
+
+static FluxionLog* fluxion_log_create(const char* path) {
+    FluxionLog* log = calloc(1, sizeof(FluxionLog));
+    if (!log) return NULL;
+
+    log->ring = malloc(sizeof(FluxionLogRecord) * FLUXION_LOG_CAPACITY);
+    log->path = malloc(strlen(path) + 1);
+    log->file = fopen(path, "wb");
+    if (!log->ring || !log->path || !log->file) {
+        if (!log->file) fprintf(stderr, "[Fluxion] Cannot open log '%s': %s\n", path, strerror(errno));
+        if (log->file) fclose(log->file);
+        free(log->path);
+        free(log->ring);
+        free(log);
+        return NULL;
+    }
+    strcpy(log->path, path);
+
+    FluxionLogHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, FLUXION_LOG_MAGIC, sizeof(FLUXION_LOG_MAGIC));
+    header.version     = FLUXION_LOG_VERSION;
+    header.record_size = sizeof(FluxionLogRecord);
+
+    struct timespec wall;
+    clock_gettime(CLOCK_REALTIME, &wall);
+    header.monotonic_ns = fluxion_time_ns();
+    header.realtime_ns  = (uint64_t)wall.tv_sec * 1000000000ULL + (uint64_t)wall.tv_nsec;
+    log->sync_ticks     = fluxion_ticks();
+    log->sync_ns        = header.monotonic_ns;
+
+    fwrite(&header, sizeof(header), 1, log->file);
+    fflush(log->file);
+
+    pthread_mutex_init(&log->lock, NULL);
+    pthread_cond_init(&log->wake, NULL);
+
+    if (pthread_create(&log->writer, NULL, fluxion_log_writer, log) != 0) {
+        fprintf(stderr, "[Fluxion] Cannot start the log writer\n");
+        pthread_cond_destroy(&log->wake);
+        pthread_mutex_destroy(&log->lock);
+        fclose(log->file);
+        free(log->path);
+        free(log->ring);
+        free(log);
+        return NULL;
+    }
+    return log;
+}
+
+void fluxion_log_destroy(FluxionLog* log) {
+    if (!log) return;
+
+    pthread_mutex_lock(&log->lock);
+    log->stopping = 1;
+    pthread_cond_signal(&log->wake);
+    pthread_mutex_unlock(&log->lock);
+    pthread_join(log->writer, NULL);
+
+    if (log->dropped > 0) {
+        fprintf(stderr, "[Fluxion] Log '%s': %llu record(s) dropped (ring full)\n",
+                log->path, (unsigned long long)log->dropped);
+    }
+
+    pthread_cond_destroy(&log->wake);
+    pthread_mutex_destroy(&log->lock);
+    fclose(log->file);
+    free(log->path);
+    free(log->ring);
+    free(log);
+}
+
+/* ============================================================================
+ * LOG API
+ * ============================================================================
+ */
+
+FluxionError fluxion_enable_logging(FluxionContext* ctx, const char* path) {
+    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
+    if (!path) return FLUXION_ERR_INVALID_ARGUMENT;
+
+    if (ctx->log) {
+        if (strcmp(ctx->log->path, path) == 0) return FLUXION_OK;
+        fluxion_disable_logging(ctx);
+    }
+
+    ctx->log = fluxion_log_create(path);
+    return ctx->log ? FLUXION_OK : FLUXION_ERR_INVALID_ARGUMENT;
+}
+
+void fluxion_disable_logging(FluxionContext* ctx) {
+    if (!ctx || !ctx->log) return;
+
+    fluxion_log_destroy(ctx->log);
+    ctx->log = NULL;
+}
+
+FluxionLogStats fluxion_log_stats(const FluxionContext* ctx) {
+    FluxionLogStats stats = { 0, 0, 0 };
+    if (!ctx || !ctx->log) return stats;
+
+    stats.logged  = ctx->log->logged;
+    stats.written = __atomic_load_n(&ctx->log->written, __ATOMIC_RELAXED);
+    stats.dropped = ctx->log->dropped;
+    return stats;
+}
+
+void fluxion_log_begin(FluxionLog* log) {
+    log->pulse_ticks = fluxion_ticks();
+}
+
+void fluxion_log_pulse(FluxionContext* ctx) {
+    FluxionLog* log = ctx->log;
+    uint64_t end_ticks = fluxion_ticks();
+
+    uint64_t head = log->head;
+    uint64_t used = head - __atomic_load_n(&log->tail, __ATOMIC_ACQUIRE);
+    if (used == FLUXION_LOG_CAPACITY) {
+        log->dropped++;
+        return;
+    }
+
+    FluxionLogRecord* r = &log->ring[head & (FLUXION_LOG_CAPACITY - 1)];
+    r->pulse_id       = ctx->current_pulse;
+    r->start_ns       = log->pulse_ticks;             // Ticks until the writer converts them
+    r->duration_ns    = end_ticks - log->pulse_ticks;
+    r->total_executed = ctx->executed_nodes;
+    r->ready_nodes    = (uint32_t)ctx->pulse_ready;
+    r->executed_nodes = (uint32_t)ctx->pulse_executed;
+    r->policy         = (uint32_t)ctx->policy;
+    r->last_error     = (int32_t)ctx->last_error;
+
+    __atomic_store_n(&log->head, head + 1, __ATOMIC_RELEASE);
+    log->logged++;
+
+    /* Half full: the writer would not keep up with its timer alone */
+    if (used + 1 == FLUXION_LOG_CAPACITY / 2) {
+        pthread_mutex_lock(&log->lock);
+        pthread_cond_signal(&log->wake);
+        pthread_mutex_unlock(&log->lock);
+    }
+}
@@ -0,0 +1,456 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_memory.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * FLUXION — PULSE ARENA
+ * ============================================================================
+ */
+
+#define FLUXION_ALIGN_UP(x) (((x) + (FLUXION_ARENA_ALIGN - 1)) & ~(size_t)(FLUXION_ARENA_ALIGN - 1))
+
+struct FluxionArenaChunk {
+    struct FluxionArenaChunk* next;
+    size_t capacity;
+    size_t used;
+    /* Data follows the (aligned) header */
+};
+
+#define FLUXION_CHUNK_HEADER FLUXION_ALIGN_UP(sizeof(struct FluxionArenaChunk))
+
+static inline unsigned char* fluxion_chunk_data(struct FluxionArenaChunk* chunk) {
+    return (unsigned char*)chunk + FLUXION_CHUNK_HEADER;
+}
+
+static inline void fluxion_arena_lock(FluxionArena* arena) {
+    while (__atomic_test_and_set(&arena->lock, __ATOMIC_ACQUIRE)) {
+        /* spin: critical sections are a few instructions long */
+    }
+}
+
+static inline void fluxion_arena_unlock(FluxionArena* arena) {
+    __atomic_clear(&arena->lock, __ATOMIC_RELEASE);
+}
+
+/* ============================================================================
+ * CHUNK INDEX
+ *
+ * Open-addressing set of the units (address >> chunk_shift) covered
+ * by the chunks; the low bit of a key marks a chunk's first unit.
+ * Writers hold the arena lock; readers take none. A table getting
+ * full is replaced by a larger copy, published atomically; replaced
+ * tables stay allocated until the arena is released, so a reader
+ * never sees freed memory.
+ * ============================================================================
+ */
+
+struct FluxionChunkIndex {
+    struct FluxionChunkIndex* retired;  // Previous (smaller) table
+    size_t mask;                        // Capacity - 1 (power of two)
+    size_t count;
+    uintptr_t keys[];                   // (unit + 1) << 1 | first (0 = empty slot)
+};
+
+static inline size_t fluxion_chunk_hash(uintptr_t key, size_t mask) {
+    return (size_t)((uint64_t)(key >> 1) * 0x9E3779B97F4A7C15ULL >> 32) & mask;
+}
+
+static void fluxion_chunk_index_put(struct FluxionChunkIndex* index, uintptr_t key) {
+    size_t i = fluxion_chunk_hash(key, index->mask);
+    while (index->keys[i]) i = (i + 1) & index->mask;
+
+    __atomic_store_n(&index->keys[i], key, __ATOMIC_RELEASE);
+    index->count++;
+}
+
+/**
+ * @brief Indexes the `units` units of a new chunk (arena lock held)
+ * @return 0 if memory is exhausted
+ */
+static int fluxion_chunk_index_add(FluxionArena* arena, uintptr_t first, size_t units) {
+    struct FluxionChunkIndex* index = arena->index;
+
+    /* At most half full */
+    if (!index || (index->count + units) * 2 > index->mask + 1) {
+        size_t capacity = index ? (index->mask + 1) * 2 : 16;
+        while ((index ? index->count : 0) + units > capacity / 2) capacity *= 2;
+
+        struct FluxionChunkIndex* grown = calloc(1, sizeof(struct FluxionChunkIndex) +
+                                                    capacity * sizeof(uintptr_t));
+        if (!grown) return 0;
+
+        grown->mask    = capacity - 1;
+        grown->retired = index;
+        for (size_t i = 0; index && i <= index->mask; i++) {
+            if (index->keys[i]) fluxion_chunk_index_put(grown, index->keys[i]);
+        }
+
+        __atomic_store_n(&arena->index, grown, __ATOMIC_RELEASE);
+        index = grown;
+    }
+
+    for (size_t u = 0; u < units; u++) {
+        fluxion_chunk_index_put(index, ((first + u + 1) << 1) | (u == 0));
+    }
+    return 1;
+}
+
+/**
+ * @brief Looks up the unit holding `address`
+ * @return 0 if no chunk covers it, 1 inside a chunk, 2 in the first unit of a chunk
+ */
+static int fluxion_chunk_index_find(FluxionArena* arena, uintptr_t address) {
+    const struct FluxionChunkIndex* index = __atomic_load_n(&arena->index, __ATOMIC_ACQUIRE);
+    if (!index) return 0;
+
+    uintptr_t unit = (address >> arena->chunk_shift) + 1;
+    for (size_t i = fluxion_chunk_hash(unit << 1, index->mask); ; i = (i + 1) & index->mask) {
+        uintptr_t key = __atomic_load_n(&index->keys[i], __ATOMIC_ACQUIRE);
+        if (key == 0) return 0;
+        if ((key >> 1) == unit) return 1 + (int)(key & 1);
+    }
+}
+
+/* ============================================================================
+ * ARENA
+ * ============================================================================
+ */
+
+void fluxion_arena_init(FluxionArena* arena, size_t chunk_size) {
+    if (!arena) return;
+
+    size_t wanted = chunk_size ? chunk_size : FLUXION_ARENA_CHUNK_SIZE;
+    unsigned shift = 12;
+    while (((size_t)1 << shift) < wanted) shift++;
+
+    arena->chunks          = NULL;
+    arena->current         = NULL;
+    arena->chunk_size      = (size_t)1 << shift;
+    arena->chunk_shift     = shift;
+    arena->index           = NULL;
+    arena->allocated_bytes = 0;
+    arena->messages        = 0;
+    arena->generation      = 0;
+    arena->lock            = 0;
+}
+
+void* fluxion_arena_alloc(FluxionArena* arena, size_t size) {
+    if (!arena) return NULL;
+
+    size = FLUXION_ALIGN_UP(size ? size : 1);
+    fluxion_arena_lock(arena);
+
+    /* Fast path: bump inside the current chunk, then reuse kept chunks */
+    struct FluxionArenaChunk* chunk = arena->current;
+    while (chunk && chunk->capacity - chunk->used < size) {
+        chunk = chunk->next;
+        if (chunk) chunk->used = 0;
+    }
+
+    if (!chunk) {
+        /* Whole chunk sizes, aligned on one: a chunk is found from any address in it */
+        size_t unit = arena->chunk_size;
+        size_t bytes = (FLUXION_CHUNK_HEADER + size + unit - 1) & ~(unit - 1);
+
+        void* block = NULL;
+        if (posix_memalign(&block, unit, bytes) != 0) block = NULL;
+        if (block && !fluxion_chunk_index_add(arena, (uintptr_t)block >> arena->chunk_shift, bytes / unit)) {
+            free(block);
+            block = NULL;
+        }
+        if (!block) {
+            fluxion_arena_unlock(arena);
+            fprintf(stderr, "[Fluxion] Failed to grow pulse arena (%zu bytes)\n", bytes);
+            return NULL;
+        }
+
+        chunk = block;
+        chunk->capacity = bytes - FLUXION_CHUNK_HEADER;
+        chunk->used     = 0;
+
+        /* Insert after the current chunk so that reset order is preserved */
+        if (arena->current) {
+            chunk->next = arena->current->next;
+            arena->current->next = chunk;
+        } else {
+            chunk->next = arena->chunks;
+            arena->chunks = chunk;
+        }
+    }
+
+    arena->current = chunk;
+
+    void* ptr = fluxion_chunk_data(chunk) + chunk->used;
+    chunk->used += size;
+    arena->allocated_bytes += size;
+
+    fluxion_arena_unlock(arena);
+    return ptr;
+}
+
+void fluxion_arena_reset(FluxionArena* arena) {
+    if (!arena) return;
+
+    /* Chunks after `current` are reset lazily when reached again */
+    if (arena->chunks) arena->chunks->used = 0;
+    arena->current = arena->chunks;
+    arena->allocated_bytes = 0;
+
+    /* Headers left in the chunks now belong to a past generation */
+    arena->messages = 0;
+    arena->generation++;
+}
+
+void fluxion_arena_release(FluxionArena* arena) {
+    if (!arena) return;
+
+    struct FluxionArenaChunk* chunk = arena->chunks;
+    while (chunk) {
+        struct FluxionArenaChunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+
+    struct FluxionChunkIndex* index = arena->index;
+    while (index) {
+        struct FluxionChunkIndex* retired = index->retired;
+        free(index);
+        index = retired;
+    }
+
+    arena->chunks = NULL;
+    arena->current = NULL;
+    arena->index = NULL;
+    arena->allocated_bytes = 0;
+}
+
+/* ============================================================================
+ * FLUXION — MESSAGES
+ * ============================================================================
+ */
+
+/**
+ * @brief Header stored right before every message payload
+ */
+typedef struct {
+    FluxionArena* arena;   // Owning arena (for copies)
+    size_t size;           // Payload size
+    uint64_t generation;   // Arena generation the message was created in
+    uint32_t refs;         // Readers still holding the payload
+    uint32_t magic;        // FLUXION_MSG_MAGIC
+} FluxionMsgHeader;
+
+#define FLUXION_MSG_HEADER FLUXION_ALIGN_UP(sizeof(FluxionMsgHeader))
+#define FLUXION_MSG_MAGIC  0x464C584DU  // "FLXM"
+
+static inline FluxionMsgHeader* fluxion_msg_header(const void* payload) {
+    return (FluxionMsgHeader*)((unsigned char*)payload - FLUXION_MSG_HEADER);
+}
+
+void* fluxion_msg_create(FluxionArena* arena, size_t size) {
+    unsigned char* block = fluxion_arena_alloc(arena, FLUXION_MSG_HEADER + size);
+    if (!block) return NULL;
+
+    FluxionMsgHeader* h = (FluxionMsgHeader*)block;
+    h->arena      = arena;
+    h->size       = size;
+    h->generation = arena->generation;
+    h->refs       = 1;
+    h->magic      = FLUXION_MSG_MAGIC;
+
+    __atomic_add_fetch(&arena->messages, 1, __ATOMIC_RELAXED);
+    return block + FLUXION_MSG_HEADER;
+}
+
+int fluxion_msg_is(FluxionArena* arena, const void* ptr) {
+    if (!arena || !ptr || ((uintptr_t)ptr & (FLUXION_ARENA_ALIGN - 1))) return 0;
+    if (__atomic_load_n(&arena->messages, __ATOMIC_RELAXED) == 0) return 0;
+
+    /* The header is read only if it lies in a chunk, past the chunk's own header */
+    uintptr_t header = (uintptr_t)ptr - FLUXION_MSG_HEADER;
+    int found = fluxion_chunk_index_find(arena, header);
+    if (found == 0) return 0;
+    if (found == 2 && (header & (arena->chunk_size - 1)) < FLUXION_CHUNK_HEADER) return 0;
+
+    /* A header ending in the next unit needs that unit to continue the chunk */
+    uintptr_t last = (uintptr_t)ptr - 1;
+    if (((header ^ last) >> arena->chunk_shift) && fluxion_chunk_index_find(arena, last) != 1) return 0;
+
+    const FluxionMsgHeader* h = (const FluxionMsgHeader*)header;
+    return h->magic == FLUXION_MSG_MAGIC && h->arena == arena &&
+           h->generation == arena->generation;
+}
+
+void* fluxion_msg_clone(const void* payload) {
+    if (!payload) return NULL;
+
+    const FluxionMsgHeader* h = fluxion_msg_header(payload);
+    void* copy = fluxion_msg_create(h->arena, h->size);
+    if (copy) memcpy(copy, payload, h->size);
+
+    return copy;
+}
+
+void fluxion_msg_retain(void* payload) {
+    if (!payload) return;
+    __atomic_add_fetch(&fluxion_msg_header(payload)->refs, 1, __ATOMIC_RELAXED);
+}
+
+void fluxion_msg_release(void* payload) {
+    if (!payload) return;
+    __atomic_sub_fetch(&fluxion_msg_header(payload)->refs, 1, __ATOMIC_ACQ_REL);
+}
+
+uint32_t fluxion_msg_refs(const void* payload) {
+    if (!payload) return 0;
+    return __atomic_load_n(&fluxion_msg_header(payload)->refs, __ATOMIC_ACQUIRE);
+}
+
+size_t fluxion_msg_size(const void* payload) {
+    return payload ? fluxion_msg_header(payload)->size : 0;
+}
+
+/* ============================================================================
+ * FLUXION — STATE SLAB
+ * ============================================================================
+ */
+
+struct FluxionSlabPage {
+    struct FluxionSlabPage* next;
+    /* Blocks follow the (aligned) header */
+};
+
+#define FLUXION_PAGE_HEADER FLUXION_ALIGN_UP(sizeof(struct FluxionSlabPage))
+
+static inline void fluxion_slab_lock(FluxionSlab* slab) {
+    while (__atomic_test_and_set(&slab->lock, __ATOMIC_ACQUIRE)) {
+        /* spin */
+    }
+}
+
+static inline void fluxion_slab_unlock(FluxionSlab* slab) {
+    __atomic_clear(&slab->lock, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Size class of a request, or -1 if it bypasses the slab
+ */
+static int fluxion_slab_class(size_t size) {
+    size_t block = FLUXION_SLAB_MIN_BLOCK;
+    for (int c = 0; c < FLUXION_SLAB_CLASSES; c++, block <<= 1) {
+        if (size <= block) return c;
+    }
+    return -1;
+}
+
+/**
+ * @brief Allocates a page (or region) and links it for release
+ */
+static unsigned char* fluxion_slab_new_page(FluxionSlab* slab, size_t bytes) {
+    struct FluxionSlabPage* page = malloc(FLUXION_PAGE_HEADER + bytes);
+    if (!page) {
+        fprintf(stderr, "[Fluxion] Failed to grow state slab (%zu bytes)\n", bytes);
+        return NULL;
+    }
+
+    page->next  = slab->pages;
+    slab->pages = page;
+    return (unsigned char*)page + FLUXION_PAGE_HEADER;
+}
+
+void fluxion_slab_init(FluxionSlab* slab) {
+    if (!slab) return;
+    memset(slab, 0, sizeof(*slab));
+}
+
+size_t fluxion_slab_block_size(size_t size) {
+    int c = fluxion_slab_class(size);
+    return c < 0 ? 0 : (size_t)FLUXION_SLAB_MIN_BLOCK << c;
+}
+
+void* fluxion_slab_alloc(FluxionSlab* slab, size_t size) {
+    if (!slab) return NULL;
+
+    int c = fluxion_slab_class(size);
+    if (c < 0) return malloc(size);
+
+    size_t block = (size_t)FLUXION_SLAB_MIN_BLOCK << c;
+    void* ptr = NULL;
+
+    fluxion_slab_lock(slab);
+
+    if (slab->free_lists[c]) {
+        /* Recycled block: the free list is threaded through the blocks */
+        ptr = slab->free_lists[c];
+        slab->free_lists[c] = *(void**)ptr;
+    } else {
+        if (!slab->bump[c] || slab->bump_end[c] - slab->bump[c] < (ptrdiff_t)block) {
+            unsigned char* page = fluxion_slab_new_page(slab, FLUXION_SLAB_PAGE_SIZE);
+            if (page) {
+                slab->bump[c]     = page;
+                slab->bump_end[c] = page + FLUXION_SLAB_PAGE_SIZE;
+            }
+        }
+
+        if (slab->bump[c] && slab->bump_end[c] - slab->bump[c] >= (ptrdiff_t)block) {
+            ptr = slab->bump[c];
+            slab->bump[c] += block;
+        }
+    }
+
+    if (ptr) slab->live_blocks++;
+
+    fluxion_slab_unlock(slab);
+    return ptr;
+}
+
+void fluxion_slab_free(FluxionSlab* slab, void* block, size_t size) {
+    if (!block) return;
+
+    int c = fluxion_slab_class(size);
+    if (!slab || c < 0) {
+        free(block);
+        return;
+    }
+
+    fluxion_slab_lock(slab);
+    *(void**)block = slab->free_lists[c];
+    slab->free_lists[c] = block;
+    slab->live_blocks--;
+    fluxion_slab_unlock(slab);
+}
+
+void* fluxion_slab_alloc_region(FluxionSlab* slab, size_t bytes) {
+    if (!slab || bytes == 0) return NULL;
+
+    fluxion_slab_lock(slab);
+    void* region = fluxion_slab_new_page(slab, bytes);
+    fluxion_slab_unlock(slab);
+
+    return region;
+}
+
+void fluxion_slab_adopt(FluxionSlab* slab, size_t blocks) {
+    if (!slab) return;
+
+    fluxion_slab_lock(slab);
+    slab->live_blocks += blocks;
+    fluxion_slab_unlock(slab);
+}
+
+void fluxion_slab_release(FluxionSlab* slab) {
+    if (!slab) return;
+
+    struct FluxionSlabPage* page = slab->pages;
+    while (page) {
+        struct FluxionSlabPage* next = page->next;
+        free(page);
+        page = next;
+    }
+
+    fluxion_slab_init(slab);
+}
@@ -1,4 +1,10 @@
 #include "../include/fluxion_node.h"
+#include "../include/fluxion_memory.h"
+#include "../include/fluxion_join.h"
+#include "../include/fluxion_coalesce.h"
+#include "../include/fluxion_async.h"
+#include "../include/fluxion_cycles.h"
+#include "../include/fluxion_profile.h"
 
 #include <string.h>
 #include <stdio.h>
@@ -8,23 +14,55 @@
  * ============================================================================
  */
 
+/* Layout: activation fields fill the first 64 bytes, execution fields the next 64 */
+typedef char fluxion_node_activation_fits[(offsetof(Node, ready_next) + sizeof(Node*) <= 64) ? 1 : -1];
+typedef char fluxion_node_execution_fits[(offsetof(Node, topo_order) + sizeof(int64_t) <= 128) ? 1 : -1];
+typedef char fluxion_node_whole_lines[(sizeof(Node) % FLUXION_NODE_ALIGN == 0) ? 1 : -1];
+
+/**
+ * @brief Usable bytes of a state block holding `size` bytes
+ */
+static size_t fluxion_state_capacity(const Node* n, size_t size) {
+    size_t block = n->state_slab ? fluxion_slab_block_size(size) : 0;
+    return block ? block : size;
+}
+
+static void* fluxion_state_alloc(struct FluxionSlab* slab, size_t size) {
+    return slab ? fluxion_slab_alloc(slab, size) : malloc(size);
+}
+
+static void fluxion_state_free(Node* n) {
+    if (!n->state) return;
+
+    if (n->state_slab) fluxion_slab_free(n->state_slab, n->state, n->state_size);
+    else free(n->state);
+
+    n->state = NULL;
+    n->state_size = 0;
+}
+
 /**
  * @brief Initialize or replace the internal state of a node
  *
  * The state is persistent memory unique to the node.
  * It allows the node to have "memory" across pulses.
+ * A replacement that fits the current block is copied in place.
  */
 void fluxion_node_set_state(Node* n, void* state_data, size_t size) {
     if (!n || !state_data || size == 0) return;
 
-    /* Clean replacement */
-    if (n->state) {
-        free(n->state);
-        n->state = NULL;
-        n->state_size = 0;
+    /* In-place replacement: same block size, no allocator round-trip */
+    if (n->state &&
+        fluxion_state_capacity(n, n->state_size) == fluxion_state_capacity(n, size)) {
+        memcpy(n->state, state_data, size);
+        n->state_size = size;
+        return;
     }
 
-    n->state = malloc(size);
+    /* Clean replacement */
+    fluxion_state_free(n);
+
+    n->state = fluxion_state_alloc(n->state_slab, size);
     if (!n->state) {
         fprintf(stderr, "[Fluxion] Failed to allocate state for node '%s'\n", n->name);
         return;
@@ -34,11 +72,95 @@ void fluxion_node_set_state(Node* n, void* state_data, size_t size) {
     n->state_size = size;
 }
 
+/**
+ * @brief Reset the state of a node to a known value
+ *
+ * Reuses the current block: nothing is allocated or freed.
+ */
+void fluxion_node_reset_state(Node* n, const void* state_data) {
+    if (!n || !n->state) return;
+
+    if (state_data) memcpy(n->state, state_data, n->state_size);
+    else memset(n->state, 0, n->state_size);
+}
+
+/**
+ * @brief Attach a node to a state allocator
+ *
+ * The current state (if any) is copied into a block of the new
+ * allocator, so that the node never mixes allocators.
+ */
+void fluxion_node_bind_slab(Node* n, struct FluxionSlab* slab) {
+    if (!n || n->state_slab == slab) return;
+
+    if (n->state) {
+        void* block = fluxion_state_alloc(slab, n->state_size);
+        if (!block) {
+            fprintf(stderr, "[Fluxion] Failed to move state of node '%s'\n", n->name);
+            return;
+        }
+
+        size_t size = n->state_size;
+        memcpy(block, n->state, size);
+        fluxion_state_free(n);
+
+        n->state = block;
+        n->state_size = size;
+    }
+
+    n->state_slab = slab;
+}
+
+void fluxion_node_set_priority(Node* n, FluxionPriority priority, uint64_t deadline_ns) {
+    if (!n) return;
+    if (priority > FLUXION_PRIORITY_CRITICAL) priority = FLUXION_PRIORITY_CRITICAL;
+
+    n->priority    = (uint8_t)priority;
+    n->deadline_ns = deadline_ns;
+}
+
+FluxionTypeId fluxion_node_type_id(Node* n) {
+    if (!n) return FLUXION_TYPE_NONE;
+
+    if (n->type_id == FLUXION_TYPE_NONE && n->data_type) {
+        n->type_id = fluxion_type_intern(n->data_type);
+    }
+    return n->type_id;
+}
+
+/**
+ * @brief Grow the subscriber array to at least `capacity` slots
+ *
+ * Growth is geometric, so linking k subscribers one by one costs
+ * O(k) amortized instead of one realloc per link.
+ */
+int fluxion_node_reserve_subscribers(Node* n, size_t capacity) {
+    if (!n) return 0;
+    if (capacity <= n->subscriber_capacity) return 1;
+
+    size_t grown = n->subscriber_capacity ? n->subscriber_capacity * 2 : 4;
+    if (grown < capacity) grown = capacity;
+
+    /* Transfer counters first: a failure leaves both arrays usable */
+    uint64_t* transfers = realloc(n->edge_transfers, sizeof(uint64_t) * grown);
+    if (!transfers) return 0;
+    n->edge_transfers = transfers;
+
+    Node** tmp = realloc(n->subscribers, sizeof(Node*) * grown);
+    if (!tmp) return 0;
+
+    n->subscribers = tmp;
+    n->subscriber_capacity = grown;
+    return 1;
+}
+
 /**
  * @brief Remove a link between two nodes
  *
  * Enables dynamic graph reconfiguration
  * without breaking memory integrity.
+ * The array is not shrunk: relinking reuses its slots.
+ * O(degree): the tail is shifted to keep subscription order.
  */
 void fluxion_node_unlink(Node* src, Node* dst) {
     if (!src || !dst || src->subscriber_count == 0) return;
@@ -47,23 +169,22 @@ void fluxion_node_unlink(Node* src, Node* dst) {
         if (src->subscribers[i] == dst) {
 
             /* Shift remaining subscribers */
-            for (size_t j = i; j < src->subscriber_count - 1; j++) {
-                src->subscribers[j] = src->subscribers[j + 1];
+            size_t tail = src->subscriber_count - 1 - i;
+            memmove(&src->subscribers[i], &src->subscribers[i + 1], tail * sizeof(Node*));
+            if (src->edge_transfers) {
+                memmove(&src->edge_transfers[i], &src->edge_transfers[i + 1], tail * sizeof(uint64_t));
             }
 
             src->subscriber_count--;
+            fluxion_topology_changed();
 
-            if (src->subscriber_count == 0) {
-                free(src->subscribers);
-                src->subscribers = NULL;
-            } else {
-                Node** tmp = realloc(
-                    src->subscribers,
-                    sizeof(Node*) * src->subscriber_count
-                );
-                if (tmp) src->subscribers = tmp;
+            /* A join forgets the slot binding with the last edge */
+            if (dst->join) {
+                for (size_t k = 0; k < src->subscriber_count; k++) {
+                    if (src->subscribers[k] == dst) return;
+                }
+                fluxion_join_unbind(dst, src);
             }
-
             return;
         }
     }
@@ -81,18 +202,28 @@ void fluxion_node_cleanup(Node* n) {
     if (n->subscribers) {
         free(n->subscribers);
         n->subscribers = NULL;
+        fluxion_topology_changed();
     }
+    free(n->edge_transfers);
+    n->edge_transfers = NULL;
 
-    if (n->state) {
-        free(n->state);
-        n->state = NULL;
-        n->state_size = 0;
-    }
+    fluxion_state_free(n);
+    n->state_slab = NULL;
+
+    fluxion_join_destroy(n);
+    fluxion_coalesce_destroy(n);
+    fluxion_async_node_destroy(n);
+    fluxion_profile_node_destroy(n);
 
     n->input_buffer = NULL;
+    n->input_count = 0;
+    n->input_stride = 0;
+    n->input_origin = NULL;
     n->subscriber_count = 0;
+    n->subscriber_capacity = 0;
     n->state_flag = FLUXION_NODE_SLEEPING;
     n->last_pulse_id = 0;
+    n->ready_next = NULL;
 }
 
 /**
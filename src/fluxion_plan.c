@@ -0,0 +1,156 @@
+#include "../include/fluxion_plan.h"
+#include "../include/fluxion_cycles.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * FLUXION — PLAN COMPILATION
+ * ============================================================================
+ */
+
+/**
+ * @brief Maps a node to `index` unless it is already mapped
+ * @return The node's index (the existing one for a duplicate)
+ */
+static uint32_t fluxion_plan_insert(FluxionPlan* plan, const Node* n, uint32_t index) {
+    uint32_t slot = fluxion_plan_hash(n, plan->index_mask);
+
+    while (plan->index_keys[slot]) {
+        if (plan->index_keys[slot] == n) return plan->index_values[slot];
+        slot = (slot + 1) & plan->index_mask;
+    }
+
+    plan->index_keys[slot]   = n;
+    plan->index_values[slot] = index;
+    return index;
+}
+
+FluxionPlan* fluxion_plan_compile(Node* graph[], size_t count) {
+    if (!graph || count == 0 || count > FLUXION_PLAN_NONE / 4) return NULL;
+
+    /* Read first: an edge changed while compiling makes the plan stale */
+    uint64_t version = fluxion_topology_version();
+
+    /* Index map at most half full */
+    uint32_t slots = 16;
+    while (slots < 2 * count) slots <<= 1;
+
+    FluxionPlan* plan = calloc(1, sizeof(FluxionPlan));
+    Node** list       = malloc(sizeof(Node*) * count);
+    uint32_t* indeg   = calloc(count, sizeof(uint32_t));
+    uint32_t* order   = malloc(sizeof(uint32_t) * count);
+
+    if (!plan || !list || !indeg || !order) goto fail_alloc;
+
+    plan->index_keys   = calloc(slots, sizeof(Node*));
+    plan->index_values = malloc(sizeof(uint32_t) * slots);
+    plan->index_mask   = slots - 1;
+    if (!plan->index_keys || !plan->index_values) goto fail_alloc;
+
+    /* --- Compact the input: drop NULL entries and duplicates --- */
+    uint32_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+        Node* node = graph[i];
+        if (!node || fluxion_plan_insert(plan, node, n) != n) continue;
+        list[n++] = node;
+    }
+
+    /* --- In-degrees, rejecting edges that leave the graph --- */
+    size_t edges = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        Node* node = list[i];
+        for (size_t j = 0; j < node->subscriber_count; j++) {
+            uint32_t dst = fluxion_plan_index(plan, node->subscribers[j]);
+            if (dst == FLUXION_PLAN_NONE) {
+                fprintf(stderr,
+                    "[Fluxion] Plan rejected: subscriber of '%s' is not part of the graph\n",
+                    node->name);
+                goto fail;
+            }
+            indeg[dst]++;
+            edges++;
+        }
+    }
+
+    if (edges >= FLUXION_PLAN_NONE) goto fail_alloc;
+
+    /* --- Kahn's algorithm (stable: independent nodes keep caller order) --- */
+    uint32_t head = 0, tail = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        if (indeg[i] == 0) order[tail++] = i;
+    }
+
+    while (head < tail) {
+        Node* node = list[order[head++]];
+        for (size_t j = 0; j < node->subscriber_count; j++) {
+            uint32_t dst = fluxion_plan_index(plan, node->subscribers[j]);
+            if (--indeg[dst] == 0) order[tail++] = dst;
+        }
+    }
+
+    if (tail != n) {
+        fprintf(stderr, "[Fluxion] Plan rejected: graph contains a cycle\n");
+        goto fail;
+    }
+
+    /* --- Freeze: nodes in topological order, CSR adjacency --- */
+    plan->nodes        = malloc(sizeof(Node*) * n);
+    plan->edge_offsets = malloc(sizeof(uint32_t) * (n + 1));
+    plan->edge_targets = malloc(sizeof(uint32_t) * (edges ? edges : 1));
+    if (!plan->nodes || !plan->edge_offsets || !plan->edge_targets) goto fail_alloc;
+
+    /* Every in-degree is back to 0: reuse them as compact -> topological ranks */
+    uint32_t* rank = indeg;
+    for (uint32_t i = 0; i < n; i++) {
+        plan->nodes[i] = list[order[i]];
+        rank[order[i]] = i;
+    }
+    for (uint32_t slot = 0; slot <= plan->index_mask; slot++) {
+        if (plan->index_keys[slot]) plan->index_values[slot] = rank[plan->index_values[slot]];
+    }
+
+    uint32_t e = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        Node* node = plan->nodes[i];
+        plan->edge_offsets[i] = e;
+        for (size_t j = 0; j < node->subscriber_count; j++) {
+            plan->edge_targets[e++] = fluxion_plan_index(plan, node->subscribers[j]);
+        }
+    }
+    plan->edge_offsets[n] = e;
+
+    plan->node_count = n;
+    plan->edge_count = e;
+    plan->topology_version = version;
+
+    free(list);
+    free(indeg);
+    free(order);
+    return plan;
+
+fail_alloc:
+    fprintf(stderr, "[Fluxion] Failed to allocate execution plan\n");
+fail:
+    free(list);
+    free(indeg);
+    free(order);
+    fluxion_plan_destroy(plan);
+    return NULL;
+}
+
+int fluxion_plan_is_current(const FluxionPlan* plan) {
+    return plan && plan->topology_version == fluxion_topology_version();
+}
+
+void fluxion_plan_destroy(FluxionPlan* plan) {
+    if (!plan) return;
+
+    free(plan->nodes);
+    free(plan->edge_offsets);
+    free(plan->edge_targets);
+    free(plan->index_keys);
+    free(plan->index_values);
+    free(plan);
+}
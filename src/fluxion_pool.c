@@ -0,0 +1,257 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "fluxion_pool.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/* ============================================================================
+ * FLUXION — WORK-STEALING POOL
+ * ============================================================================
+ */
+
+/**
+ * @brief Range of batch indices owned by a worker
+ *
+ * [head, tail) is packed into a single word (head in the low half,
+ * tail in the high half). The owner claims from the head and thieves
+ * from the tail; both sides update the word with a CAS, so each index
+ * is handed out exactly once.
+ */
+typedef struct {
+    uint64_t range;
+    char pad[64 - sizeof(uint64_t)];   // One deque per cache line
+} FluxionDeque;
+
+typedef struct {
+    FluxionPool* pool;
+    unsigned index;
+} FluxionPoolWorker;
+
+struct FluxionPool {
+    unsigned workers;
+    pthread_t* threads;
+    FluxionPoolWorker* slots;
+    FluxionDeque* deques;
+
+    /* --- Batch hand-off --- */
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_cond_t done;
+    uint64_t generation;      // Incremented for every batch
+    unsigned active;          // Background workers still on the batch
+    int shutdown;
+
+    /* --- Current batch --- */
+    Node** nodes;
+    FluxionPoolTask task;
+    void* arg;
+    size_t executed;
+};
+
+/* ============================================================================
+ * DEQUES
+ * ============================================================================
+ */
+
+static inline uint64_t fluxion_deque_pack(uint32_t head, uint32_t tail) {
+    return ((uint64_t)tail << 32) | head;
+}
+
+static int fluxion_deque_pop(FluxionDeque* d, uint32_t* index) {
+    uint64_t range = __atomic_load_n(&d->range, __ATOMIC_ACQUIRE);
+
+    for (;;) {
+        uint32_t head = (uint32_t)range;
+        uint32_t tail = (uint32_t)(range >> 32);
+        if (head >= tail) return 0;
+
+        if (__atomic_compare_exchange_n(&d->range, &range,
+                fluxion_deque_pack(head + 1, tail), 0,
+                __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            *index = head;
+            return 1;
+        }
+    }
+}
+
+static int fluxion_deque_steal(FluxionDeque* d, uint32_t* index) {
+    uint64_t range = __atomic_load_n(&d->range, __ATOMIC_ACQUIRE);
+
+    for (;;) {
+        uint32_t head = (uint32_t)range;
+        uint32_t tail = (uint32_t)(range >> 32);
+        if (head >= tail) return 0;
+
+        if (__atomic_compare_exchange_n(&d->range, &range,
+                fluxion_deque_pack(head, tail - 1), 0,
+                __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            *index = tail - 1;
+            return 1;
+        }
+    }
+}
+
+/* ============================================================================
+ * WORKERS
+ * ============================================================================
+ */
+
+/**
+ * @brief Drains the own deque, then steals until every deque is empty
+ *
+ * A batch never spawns new work, so an empty sweep means the worker
+ * has nothing left to claim.
+ */
+static size_t fluxion_pool_work(FluxionPool* pool, unsigned self) {
+    size_t executed = 0;
+    uint32_t index;
+
+    while (fluxion_deque_pop(&pool->deques[self], &index)) {
+        executed += pool->task(pool->arg, pool->nodes[index], self);
+    }
+
+    for (unsigned k = 1; k < pool->workers; k++) {
+        FluxionDeque* victim = &pool->deques[(self + k) % pool->workers];
+        while (fluxion_deque_steal(victim, &index)) {
+            executed += pool->task(pool->arg, pool->nodes[index], self);
+        }
+    }
+
+    return executed;
+}
+
+static void* fluxion_pool_thread(void* arg) {
+    FluxionPoolWorker* slot = arg;
+    FluxionPool* pool = slot->pool;
+    uint64_t seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+
+    for (;;) {
+        while (!pool->shutdown && pool->generation == seen) {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        if (pool->shutdown) break;
+
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        size_t executed = fluxion_pool_work(pool, slot->index);
+
+        pthread_mutex_lock(&pool->lock);
+        pool->executed += executed;
+        if (--pool->active == 0) pthread_cond_signal(&pool->done);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+/* ============================================================================
+ * POOL API
+ * ============================================================================
+ */
+
+FluxionPool* fluxion_pool_create(unsigned workers) {
+    if (workers == 0) return NULL;
+
+    FluxionPool* pool = calloc(1, sizeof(FluxionPool));
+    if (!pool) return NULL;
+
+    pool->workers = workers;
+    pool->threads = calloc(workers, sizeof(pthread_t));
+    pool->slots   = calloc(workers, sizeof(FluxionPoolWorker));
+    pool->deques  = calloc(workers, sizeof(FluxionDeque));
+
+    if (!pool->threads || !pool->slots || !pool->deques) {
+        free(pool->threads);
+        free(pool->slots);
+        free(pool->deques);
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    /* Worker 0 is the calling thread */
+    for (unsigned i = 1; i < workers; i++) {
+        pool->slots[i].pool  = pool;
+        pool->slots[i].index = i;
+
+        if (pthread_create(&pool->threads[i], NULL, fluxion_pool_thread, &pool->slots[i]) != 0) {
+            pool->workers = i;
+            break;
+        }
+    }
+
+    return pool;
+}
+
+void fluxion_pool_destroy(FluxionPool* pool) {
+    if (!pool) return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (unsigned i = 1; i < pool->workers; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+
+    free(pool->threads);
+    free(pool->slots);
+    free(pool->deques);
+    free(pool);
+}
+
+unsigned fluxion_pool_size(const FluxionPool* pool) {
+    return pool ? pool->workers : 0;
+}
+
+size_t fluxion_pool_run(
+    FluxionPool* pool,
+    Node** nodes,
+    size_t count,
+    FluxionPoolTask task,
+    void* arg
+) {
+    if (!pool || !nodes || !task || count == 0 || count > UINT32_MAX) return 0;
+
+    pool->nodes = nodes;
+    pool->task  = task;
+    pool->arg   = arg;
+
+    /* Even split: worker w owns [w * count / W, (w + 1) * count / W) */
+    for (unsigned w = 0; w < pool->workers; w++) {
+        uint32_t head = (uint32_t)((uint64_t)count * w / pool->workers);
+        uint32_t tail = (uint32_t)((uint64_t)count * (w + 1) / pool->workers);
+        __atomic_store_n(&pool->deques[w].range, fluxion_deque_pack(head, tail), __ATOMIC_RELAXED);
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->executed = 0;
+    pool->active   = pool->workers - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    size_t executed = fluxion_pool_work(pool, 0);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->active > 0) {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+    executed += pool->executed;
+    pthread_mutex_unlock(&pool->lock);
+
+    return executed;
+}
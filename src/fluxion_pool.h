@@ -0,0 +1,60 @@
+#ifndef FLUXION_POOL_H
+#define FLUXION_POOL_H
+
+#include <stddef.h>
+
+#include "../include/fluxion_node.h"
+
+/* ============================================================================
+ * FLUXION — WORK-STEALING POOL (INTERNAL)
+ *
+ * Executes a batch of independent nodes on a fixed set of workers.
+ * The calling thread participates as worker 0; every node of a batch
+ * is claimed exactly once, and fluxion_pool_run() returns only after
+ * the whole batch has completed.
+ * ============================================================================
+ */
+
+typedef struct FluxionPool FluxionPool;
+
+/**
+ * @brief Work performed on one node
+ * @param arg User argument given to fluxion_pool_run()
+ * @param n Claimed node
+ * @param worker Index of the executing worker (0 = calling thread)
+ * @return Number of executed actions (0 or 1)
+ */
+typedef size_t (*FluxionPoolTask)(void* arg, Node* n, unsigned worker);
+
+/**
+ * @brief Starts a pool of `workers` workers (workers - 1 threads)
+ */
+FluxionPool* fluxion_pool_create(unsigned workers);
+
+/**
+ * @brief Stops and joins the workers
+ */
+void fluxion_pool_destroy(FluxionPool* pool);
+
+/**
+ * @brief Number of workers, the calling thread included
+ */
+unsigned fluxion_pool_size(const FluxionPool* pool);
+
+/**
+ * @brief Runs `task` on every node of the batch and waits for completion
+ *
+ * The batch is split evenly across the workers' deques; idle workers
+ * steal from the opposite end of the other deques.
+ *
+ * @return Sum of the values returned by the task
+ */
+size_t fluxion_pool_run(
+    FluxionPool* pool,
+    Node** nodes,
+    size_t count,
+    FluxionPoolTask task,
+    void* arg
+);
+
+#endif /* FLUXION_POOL_H */
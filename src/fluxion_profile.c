@@ -0,0 +1,181 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_profile.h"
+#include "fluxion_clock.h"
+#include "fluxion_histogram.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * FLUXION — NODE PROFILES IMPLEMENTATION
+ *
+ * Ticks are converted with the rate measured since the first call to
+ * fluxion_enable_profiling(), the same for every context: the longer
+ * the process has profiled, the more exact the conversion.
+ * ============================================================================
+ */
+
+struct FluxionProfile {
+    uint64_t ready_ticks;         // Last activation (0 = none pending)
+    uint64_t runs;
+    uint64_t total_ticks;
+    uint64_t max_ticks;
+    uint64_t waits;
+    uint64_t wait_max_ticks;
+    uint64_t latency[FLUXION_LATENCY_BUCKETS];
+    uint64_t wait[FLUXION_LATENCY_BUCKETS];
+};
+
+static pthread_once_t fluxion_epoch_once = PTHREAD_ONCE_INIT;
+static uint64_t fluxion_epoch_ticks;
+static uint64_t fluxion_epoch_ns;
+
+static void fluxion_epoch_init(void) {
+    fluxion_epoch_ns    = fluxion_time_ns();
+    fluxion_epoch_ticks = fluxion_ticks();
+}
+
+/**
+ * @brief Nanoseconds per tick since the epoch
+ */
+static double fluxion_profile_rate(void) {
+    pthread_once(&fluxion_epoch_once, fluxion_epoch_init);
+    return fluxion_ticks_rate(fluxion_epoch_ticks, fluxion_epoch_ns, fluxion_ticks(), fluxion_time_ns());
+}
+
+static inline uint64_t fluxion_ticks_to_ns(uint64_t ticks, double rate) {
+    return (uint64_t)((double)ticks * rate);
+}
+
+/* ============================================================================
+ * RECORDING
+ * ============================================================================
+ */
+
+static inline struct FluxionProfile* fluxion_profile_of(Node* n) {
+    if (!n->profile) n->profile = calloc(1, sizeof(struct FluxionProfile));
+    return n->profile;
+}
+
+static void fluxion_profile_add(struct FluxionProfile* p, uint64_t ready, uint64_t begin, uint64_t end) {
+    uint64_t run = end - begin;
+    p->runs++;
+    p->total_ticks += run;
+    if (run > p->max_ticks) p->max_ticks = run;
+    p->latency[fluxion_latency_bucket(run)]++;
+
+    if (ready == 0 || begin < ready) return;
+
+    uint64_t wait = begin - ready;
+    p->waits++;
+    if (wait > p->wait_max_ticks) p->wait_max_ticks = wait;
+    p->wait[fluxion_latency_bucket(wait)]++;
+}
+
+void fluxion_profile_ready(Node* n) {
+    struct FluxionProfile* p = fluxion_profile_of(n);
+    if (p) p->ready_ticks = fluxion_ticks();
+}
+
+void fluxion_profile_run(Node* n, uint64_t begin, uint64_t end) {
+    struct FluxionProfile* p = fluxion_profile_of(n);
+    if (!p) return;
+
+    fluxion_profile_add(p, p->ready_ticks, begin, end);
+    p->ready_ticks = 0;
+}
+
+void fluxion_profile_job(Node* n, uint64_t submitted, uint64_t begin, uint64_t end) {
+    struct FluxionProfile* p = fluxion_profile_of(n);
+    if (p) fluxion_profile_add(p, submitted, begin, end);
+}
+
+void fluxion_profile_node_destroy(Node* n) {
+    if (!n) return;
+
+    free(n->profile);
+    n->profile = NULL;
+}
+
+/* ============================================================================
+ * PROFILING API
+ * ============================================================================
+ */
+
+FluxionError fluxion_enable_profiling(FluxionContext* ctx, int enabled) {
+    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
+
+    pthread_once(&fluxion_epoch_once, fluxion_epoch_init);
+    ctx->profiling = enabled ? 1 : 0;
+    return FLUXION_OK;
+}
+
+static FluxionProfileStats fluxion_profile_summary(const Node* n, double rate) {
+    FluxionProfileStats s;
+    memset(&s, 0, sizeof(s));
+    s.node = n;
+    if (!n) return s;
+
+    for (size_t i = 0; n->edge_transfers && i < n->subscriber_count; i++) s.transfers += n->edge_transfers[i];
+
+    const struct FluxionProfile* p = n->profile;
+    if (!p) return s;
+
+    s.runs     = p->runs;
+    s.total_ns = fluxion_ticks_to_ns(p->total_ticks, rate);
+    s.max_ns   = fluxion_ticks_to_ns(p->max_ticks, rate);
+    s.p50_ns   = fluxion_ticks_to_ns(fluxion_histogram_percentile(p->latency, p->runs, p->max_ticks, 0.50), rate);
+    s.p99_ns   = fluxion_ticks_to_ns(fluxion_histogram_percentile(p->latency, p->runs, p->max_ticks, 0.99), rate);
+    s.p999_ns  = fluxion_ticks_to_ns(fluxion_histogram_percentile(p->latency, p->runs, p->max_ticks, 0.999), rate);
+
+    s.wait_max_ns = fluxion_ticks_to_ns(p->wait_max_ticks, rate);
+    s.wait_p50_ns = fluxion_ticks_to_ns(fluxion_histogram_percentile(p->wait, p->waits, p->wait_max_ticks, 0.50), rate);
+    s.wait_p99_ns = fluxion_ticks_to_ns(fluxion_histogram_percentile(p->wait, p->waits, p->wait_max_ticks, 0.99), rate);
+    return s;
+}
+
+FluxionProfileStats fluxion_node_profile(const Node* n) {
+    return fluxion_profile_summary(n, fluxion_profile_rate());
+}
+
+uint64_t fluxion_node_percentile(const Node* n, double q) {
+    if (!n || !n->profile) return 0;
+
+    const struct FluxionProfile* p = n->profile;
+    return fluxion_ticks_to_ns(fluxion_histogram_percentile(p->latency, p->runs, p->max_ticks, q),
+                               fluxion_profile_rate());
+}
+
+void fluxion_reset_profile(Node* n) {
+    if (n && n->profile) memset(n->profile, 0, sizeof(struct FluxionProfile));
+}
+
+size_t fluxion_hottest_nodes(
+    Node* graph[],
+    size_t count,
+    FluxionProfileStats out[],
+    size_t max
+) {
+    if (!graph || !out || max == 0) return 0;
+
+    double rate = fluxion_profile_rate();
+    size_t found = 0;
+
+    /* Insertion into the top list, hottest first */
+    for (size_t i = 0; i < count; i++) {
+        Node* n = graph[i];
+        if (!n || !n->profile || n->profile->runs == 0) continue;
+
+        uint64_t total = n->profile->total_ticks;
+        size_t at = found;
+        while (at > 0 && fluxion_ticks_to_ns(total, rate) > out[at - 1].total_ns) at--;
+        if (at >= max) continue;
+
+        size_t last = (found < max) ? found++ : max - 1;
+        memmove(&out[at + 1], &out[at], (last - at) * sizeof(FluxionProfileStats));
+        out[at] = fluxion_profile_summary(n, rate);
+    }
+    return found;
+}
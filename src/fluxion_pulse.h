@@ -0,0 +1,23 @@
+#ifndef FLUXION_PULSE_H
+#define FLUXION_PULSE_H
+
+#include "../include/fluxion_runtime.h"
+
+/* ============================================================================
+ * FLUXION — PULSE ENTRY POINTS (INTERNAL)
+ *
+ * Pulses started by the runtime's own modules rather than by the
+ * application. They leave the context's configuration untouched.
+ * ============================================================================
+ */
+
+/**
+ * @brief Runs a pulse over the ready queue, whatever the context's scheduling
+ *
+ * Delivers async completions like any pulse. Used by
+ * fluxion_async_poll(): a full-scan context has no graph to walk
+ * there, and a pulse of the ready queue always ends.
+ */
+void fluxion_pulse_ready(FluxionContext* ctx);
+
+#endif /* FLUXION_PULSE_H */
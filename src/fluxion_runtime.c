@@ -1,7 +1,22 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include "../include/fluxion_runtime.h"
+#include "../include/fluxion_cycles.h"
+#include "../include/fluxion_join.h"
+#include "../include/fluxion_coalesce.h"
+#include "../include/fluxion_sched.h"
+#include "../include/fluxion_async.h"
+#include "../include/fluxion_log.h"
+#include "../include/fluxion_trace.h"
+#include "../include/fluxion_profile.h"
+#include "../include/fluxion_shm.h"
+#include "fluxion_clock.h"
+#include "fluxion_pool.h"
+#include "fluxion_pulse.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <time.h>
 
 /* ============================================================================
  * RUNTIME INITIALIZATION
@@ -14,14 +29,208 @@ FluxionContext fluxion_init(void) {
     ctx.executed_nodes  = 0;
     ctx.last_error      = FLUXION_OK;
     ctx.policy          = FLUXION_EXEC_DEFERRED;
+    ctx.plan            = NULL;
+    ctx.scheduling      = FLUXION_SCHED_READY_QUEUE;
+    ctx.worklist        = NULL;
+    ctx.worklist_capacity = 0;
+    ctx.ready_head      = NULL;
+    ctx.ready_count     = 0;
+    ctx.ready_list      = NULL;
+    ctx.ready_list_count = 0;
+    ctx.ready_list_capacity = 0;
+    ctx.ready_list_plan = NULL;
+    ctx.ready_spare     = NULL;
+    ctx.ready_spare_capacity = 0;
+    ctx.pool            = NULL;
+    ctx.deterministic   = 0;
+    ctx.type_checks     = 0;
+    ctx.schedule        = NULL;
+    ctx.schedule_capacity = 0;
+    ctx.levels          = NULL;
+    ctx.levels_capacity = 0;
+    ctx.flow_heap       = NULL;
+    ctx.flow_count      = 0;
+    ctx.flow_capacity   = 0;
+    ctx.coalesce_head   = NULL;
+    ctx.coalesce_tail   = NULL;
+    ctx.coalesce_flushing = 0;
+    ctx.ordering        = FLUXION_ORDER_TOPOLOGICAL;
+    ctx.pulse_start_ns  = 0;
+    ctx.class_stats     = NULL;
+    ctx.async           = NULL;
+    ctx.activated_nodes = 0;
+    ctx.edge_transfers  = 0;
+    ctx.running_nodes   = 0;
+    ctx.pulse_ready     = 0;
+    ctx.pulse_executed  = 0;
+    ctx.activated_mark  = 0;
+    ctx.log             = NULL;
+    ctx.tracer          = NULL;
+    ctx.profiling       = 0;
+    ctx.shm             = NULL;
+    ctx.cycle_graph     = NULL;
+    ctx.cycle_graph_count = 0;
+    ctx.cycle_version   = 0;
+    ctx.cycle_count     = 0;
+    fluxion_arena_init(&ctx.arena, FLUXION_ARENA_CHUNK_SIZE);
+    fluxion_slab_init(&ctx.state_slab);
     return ctx;
 }
 
+/**
+ * @brief Discards the emissions held by coalescing sources
+ */
+static void fluxion_drop_coalesced(FluxionContext* ctx) {
+    Node* n = ctx->coalesce_head;
+    while (n) {
+        FluxionCoalesce* c = n->coalesce;
+        Node* next = c->pending_next;
+        fluxion_coalesce_drop(c);
+        c->pending      = 0;
+        c->pending_next = NULL;
+        c->pending_ctx  = NULL;
+        n = next;
+    }
+    ctx->coalesce_head = NULL;
+    ctx->coalesce_tail = NULL;
+}
+
+void fluxion_cleanup(FluxionContext* ctx) {
+    if (!ctx) return;
+
+    fluxion_drop_coalesced(ctx);
+
+    free(ctx->worklist);
+    ctx->worklist = NULL;
+    ctx->worklist_capacity = 0;
+    ctx->plan = NULL;
+
+    free(ctx->ready_list);
+    free(ctx->ready_spare);
+    ctx->ready_list = NULL;
+    ctx->ready_spare = NULL;
+    ctx->ready_list_count = 0;
+    ctx->ready_list_capacity = 0;
+    ctx->ready_spare_capacity = 0;
+    ctx->ready_list_plan = NULL;
+
+    fluxion_pool_destroy(ctx->pool);
+    ctx->pool = NULL;
+
+    free(ctx->schedule);
+    ctx->schedule = NULL;
+    ctx->schedule_capacity = 0;
+
+    free(ctx->levels);
+    ctx->levels = NULL;
+    ctx->levels_capacity = 0;
+
+    free(ctx->flow_heap);
+    ctx->flow_heap = NULL;
+    ctx->flow_count = 0;
+    ctx->flow_capacity = 0;
+
+    free(ctx->class_stats);
+    ctx->class_stats = NULL;
+
+    fluxion_async_destroy(ctx->async);
+    ctx->async = NULL;
+
+    fluxion_log_destroy(ctx->log);
+    ctx->log = NULL;
+
+    fluxion_trace_destroy(ctx->tracer);
+    ctx->tracer = NULL;
+
+    fluxion_shm_destroy(ctx->shm);
+    ctx->shm = NULL;
+
+    fluxion_arena_release(&ctx->arena);
+
+    if (ctx->state_slab.live_blocks > 0) {
+        fprintf(stderr, "[Fluxion] Warning: %zu node states still bound to the context\n",
+                ctx->state_slab.live_blocks);
+    }
+    fluxion_slab_release(&ctx->state_slab);
+}
+
 void fluxion_set_policy(FluxionContext* ctx, FluxionExecPolicy policy) {
     if (!ctx) return;
     ctx->policy = policy;
 }
 
+const char* fluxion_policy_name(FluxionExecPolicy policy) {
+    switch (policy) {
+        case FLUXION_EXEC_IMMEDIATE: return "IMMEDIATE";
+        case FLUXION_EXEC_DEFERRED:  return "DEFERRED";
+        case FLUXION_EXEC_PARALLEL:  return "PARALLEL";
+        case FLUXION_EXEC_DATAFLOW:  return "DATAFLOW";
+    }
+    return "UNKNOWN";
+}
+
+FluxionError fluxion_set_workers(FluxionContext* ctx, unsigned workers) {
+    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
+
+    fluxion_pool_destroy(ctx->pool);
+    ctx->pool = NULL;
+
+    if (workers > 1) {
+        ctx->pool = fluxion_pool_create(workers);
+        if (!ctx->pool) return FLUXION_ERR_OUT_OF_MEMORY;
+    }
+
+    return FLUXION_OK;
+}
+
+void fluxion_set_deterministic(FluxionContext* ctx, int enabled) {
+    if (!ctx) return;
+    ctx->deterministic = enabled;
+}
+
+void fluxion_set_scheduling(FluxionContext* ctx, FluxionScheduling scheduling) {
+    if (!ctx) return;
+    ctx->scheduling = scheduling;
+}
+
+void fluxion_set_ordering(FluxionContext* ctx, FluxionOrdering ordering) {
+    if (!ctx) return;
+    ctx->ordering = ordering;
+}
+
+void fluxion_set_type_checking(FluxionContext* ctx, int enabled) {
+    if (!ctx) return;
+    ctx->type_checks = enabled;
+}
+
+FluxionError fluxion_set_plan(FluxionContext* ctx, const FluxionPlan* plan) {
+    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
+
+    if (plan && !fluxion_plan_is_current(plan)) {
+        fprintf(stderr, "[Fluxion] Plan not bound: the graph changed since it was compiled\n");
+        ctx->plan = NULL;
+        return FLUXION_ERR_INVALID_ARGUMENT;
+    }
+    ctx->plan = plan;
+    return FLUXION_OK;
+}
+
+/**
+ * @brief Bound plan containing `n`, unbinding a stale one
+ * @return NULL if `n` propagates through subscriber pointers
+ */
+static const FluxionPlan* fluxion_plan_for(FluxionContext* ctx, const Node* n) {
+    const FluxionPlan* plan = ctx->plan;
+    if (!plan) return NULL;
+
+    if (!fluxion_plan_is_current(plan)) {
+        fprintf(stderr, "[Fluxion] Plan unbound: the graph changed since it was compiled\n");
+        ctx->plan = NULL;
+        return NULL;
+    }
+    return fluxion_plan_contains(plan, n) ? plan : NULL;
+}
+
 /* ============================================================================
  * GRAPH CONSTRUCTION
  * ============================================================================
@@ -30,9 +239,8 @@ void fluxion_set_policy(FluxionContext* ctx, FluxionExecPolicy policy) {
 FluxionError fluxion_link(Node* src, Node* dst) {
     if (!src || !dst) return FLUXION_ERR_INVALID_NODE;
 
-    /* Strict type validation */
-    if (src->data_type && dst->data_type &&
-        strcmp(src->data_type, dst->data_type) != 0) {
+    /* Strict type validation (interned IDs: an integer compare) */
+    if (!fluxion_type_compatible(fluxion_node_type_id(src), fluxion_node_type_id(dst))) {
 
         fprintf(stderr,
             "[Fluxion] Warning: type mismatch %s(%s) -> %s(%s)\n",
@@ -41,46 +249,470 @@ FluxionError fluxion_link(Node* src, Node* dst) {
         );
     }
 
-    /* Incremental allocation */
-    Node** tmp = realloc(src->subscribers, sizeof(Node*) * (src->subscriber_count + 1));
-    if (!tmp) return FLUXION_ERR_INVALID_NODE;
+    /* Online topological order: cycles are rejected once, here */
+    FluxionError err = fluxion_topo_insert(src, dst);
+    if (err == FLUXION_ERR_CYCLE_DETECTED) {
+        fprintf(stderr,
+            "[Fluxion] Link rejected: %s -> %s would close a cycle\n",
+            src->name, dst->name);
+    }
+    if (err != FLUXION_OK) return err;
+
+    /* Fan-in: the edge fills a slot of the join */
+    if (dst->join) {
+        err = fluxion_join_bind(dst, src, FLUXION_JOIN_NEXT_SLOT);
+        if (err != FLUXION_OK) return err;
+    }
+
+    /* Amortized growth */
+    if (!fluxion_node_reserve_subscribers(src, src->subscriber_count + 1)) {
+        return FLUXION_ERR_OUT_OF_MEMORY;
+    }
 
-    src->subscribers = tmp;
+    src->edge_transfers[src->subscriber_count] = 0;
     src->subscribers[src->subscriber_count++] = dst;
+    fluxion_topology_changed();
 
     return FLUXION_OK;
 }
 
+FluxionError fluxion_link_slot(Node* src, Node* dst, uint32_t slot) {
+    if (!src || !dst) return FLUXION_ERR_INVALID_NODE;
+    if (!dst->join) return FLUXION_ERR_INVALID_ARGUMENT;
+
+    int previous = fluxion_join_slot_of(dst->join, src);
+
+    FluxionError err = fluxion_join_bind(dst, src, slot);
+    if (err != FLUXION_OK) return err;
+
+    err = fluxion_link(src, dst);
+    if (err != FLUXION_OK) {
+        if (previous < 0) fluxion_join_unbind(dst, src);
+        else fluxion_join_bind(dst, src, (uint32_t)previous);
+    }
+    return err;
+}
+
 /* ============================================================================
- * INTERNAL PROPAGATION (RECURSIVE & SAFE)
+ * INTERNAL PROPAGATION (ITERATIVE WORKLIST)
  * ============================================================================
  */
 
-static void fluxion_propagate(
+/**
+ * @brief Depth-first traversal frame: a node and its remaining edges
+ *
+ * For plan-driven traversal, [begin, edge) indexes the CSR row of the
+ * node; otherwise it indexes the node's subscriber array. Edges are
+ * consumed from the last one down, so that siblings end up queued in
+ * subscription order.
+ */
+struct FluxionWorkItem {
+    Node* node;
+    size_t begin;
+    size_t edge;
+};
+
+/**
+ * @brief Ensures the worklist can hold `needed` frames
+ *
+ * Grows geometrically: once the deepest traversal has been seen,
+ * propagation no longer allocates.
+ */
+static int fluxion_worklist_reserve(FluxionContext* ctx, size_t needed) {
+    if (needed <= ctx->worklist_capacity) return 1;
+
+    size_t capacity = ctx->worklist_capacity ? ctx->worklist_capacity : 64;
+    while (capacity < needed) capacity *= 2;
+
+    struct FluxionWorkItem* tmp = realloc(ctx->worklist, sizeof(struct FluxionWorkItem) * capacity);
+    if (!tmp) return 0;
+
+    ctx->worklist = tmp;
+    ctx->worklist_capacity = capacity;
+    return 1;
+}
+
+static int fluxion_ready_list_reserve(FluxionContext* ctx, size_t needed) {
+    if (needed <= ctx->ready_list_capacity) return 1;
+
+    size_t capacity = ctx->ready_list_capacity ? ctx->ready_list_capacity : 64;
+    while (capacity < needed) capacity *= 2;
+
+    Node** tmp = realloc(ctx->ready_list, sizeof(Node*) * capacity);
+    if (!tmp) return 0;
+
+    ctx->ready_list = tmp;
+    ctx->ready_list_capacity = capacity;
+    return 1;
+}
+
+/**
+ * @brief Moves the plan ready list to the head of the ready queue
+ *
+ * The list holds the newest activations: prepending it in reverse
+ * post-order keeps the queue topologically ordered.
+ */
+static void fluxion_splice_ready_list(FluxionContext* ctx) {
+    Node* head = ctx->ready_head;
+    for (size_t i = 0; i < ctx->ready_list_count; i++) {
+        Node* n = ctx->ready_list[i];
+        n->ready_next = head;
+        head = n;
+    }
+
+    ctx->ready_head = head;
+    ctx->ready_count += ctx->ready_list_count;
+    ctx->ready_list_count = 0;
+}
+
+/**
+ * @brief Splices the plan ready list, for the queue consumers of a pulse
+ *
+ * Actions may activate plan nodes while the queue runs: their round
+ * comes after the current one, like any other activation.
+ * @return 1 if the ready queue holds nodes
+ */
+static inline int fluxion_ready_pending(FluxionContext* ctx) {
+    if (ctx->ready_list_count) fluxion_splice_ready_list(ctx);
+    return ctx->ready_head != NULL;
+}
+
+/**
+ * @brief Payload carried by one emission
+ */
+typedef struct {
+    void* data;
+    size_t count;   // 0 = single payload
+    size_t stride;
+    int msg;        // data is a message of the pulse arena
+} FluxionInput;
+
+/**
+ * @brief Marks a node ready for the current pulse
+ */
+static inline void fluxion_activate(FluxionContext* ctx, Node* n, const FluxionInput* in) {
+    n->input_buffer  = in->data;
+    n->input_count   = in->count;
+    n->input_stride  = in->stride;
+    n->input_origin  = in->msg ? in->data : NULL;
+    n->input_writer  = INT64_MIN;
+    n->state_flag    = FLUXION_NODE_READY;
+
+    /* Every reader holds a reference until its action has run */
+    if (in->msg) fluxion_msg_retain(in->data);
+    n->last_pulse_id = ctx->current_pulse;
+    ctx->activated_nodes++;
+    if (ctx->profiling) fluxion_profile_ready(n);
+}
+
+/**
+ * @brief Counts an input handed along the `index`-th edge of `src`
+ */
+static inline void fluxion_count_transfer(FluxionContext* ctx, Node* src, size_t index) {
+    ctx->edge_transfers++;
+    if (src->edge_transfers && index < src->subscriber_count) src->edge_transfers[index]++;
+}
+
+/**
+ * @brief Fills the slot of `join` bound to the edge from `src`
+ */
+static inline void fluxion_join_deliver_from(
+    FluxionContext* ctx,
+    Node* join,
+    const Node* src,
+    const FluxionInput* in
+) {
+    int slot = fluxion_join_slot_of(join->join, src);
+    if (slot >= 0) fluxion_join_deliver(join->join, (uint32_t)slot, in->data, in->msg, ctx->current_pulse);
+}
+
+/**
+ * @brief Pushes an activated node on the worklist
+ * @param index Position of `n` in the plan (ignored without a plan)
+ */
+static inline void fluxion_worklist_push(
     FluxionContext* ctx,
+    const FluxionPlan* plan,
+    size_t top,
     Node* n,
-    void* data,
-    int depth
+    uint32_t index
 ) {
-    if (!ctx || !n) return;
+    struct FluxionWorkItem* item = &ctx->worklist[top];
+    item->node = n;
 
-    /* Loop protection and excessive depth check */
-    if (depth > 1024) {
-        ctx->last_error = FLUXION_ERR_CYCLE_DETECTED;
-        return;
+    if (plan) {
+        item->begin = plan->edge_offsets[index];
+        item->edge  = plan->edge_offsets[index + 1];
+    } else {
+        item->begin = 0;
+        item->edge  = n->subscriber_count;
     }
 
+    /* Async and join subscribers wait for an output (job or firing) */
+    if (n->async_action || n->join_action) item->edge = item->begin;
+}
+
+/**
+ * @brief Activates `target` and every node reachable from it
+ *
+ * Nodes are marked when first reached, so each node is visited at most
+ * once per pulse and cycles terminate without any depth limit.
+ * When `plan` is set, successors are read from its CSR adjacency.
+ *
+ * Activated nodes are queued in reverse post-order, which is a
+ * topological order of the reached subgraph. Prepending each emission's
+ * batch keeps the whole ready queue topologically ordered: nodes reached
+ * by an earlier emission of the same pulse are never upstream of the
+ * nodes discovered later.
+ *
+ * Through a plan, nodes are appended to the ready list in post-order
+ * instead, so that fluxion_pulse_plan() walks an array. The list stays
+ * newer than the queue: pointer-based propagation splices it first.
+ */
+static FluxionError fluxion_propagate(
+    FluxionContext* ctx,
+    const FluxionPlan* plan,
+    Node* target,
+    const FluxionInput* in
+) {
     /* Already processed this pulse? */
-    if (n->last_pulse_id == ctx->current_pulse) return;
+    if (target->last_pulse_id == ctx->current_pulse) return FLUXION_OK;
 
-    /* Update data */
-    n->input_buffer  = data;
-    n->state_flag    = FLUXION_NODE_READY;
-    n->last_pulse_id = ctx->current_pulse;
+    if (plan) {
+        if (ctx->ready_list_count && ctx->ready_list_plan != plan) fluxion_splice_ready_list(ctx);
+        if (!fluxion_ready_list_reserve(ctx, ctx->ready_list_count + 1)) return FLUXION_ERR_OUT_OF_MEMORY;
+        ctx->ready_list_plan = plan;
+    } else if (ctx->ready_list_count) {
+        fluxion_splice_ready_list(ctx);
+    }
+
+    if (!fluxion_worklist_reserve(ctx, 1)) return FLUXION_ERR_OUT_OF_MEMORY;
+
+    FluxionError err = FLUXION_OK;
+    Node* head = NULL;
+    Node* tail = NULL;
+    size_t queued = 0;
+
+    fluxion_activate(ctx, target, in);
+    fluxion_worklist_push(ctx, plan, 0, target, fluxion_plan_index(plan, target));
+    size_t top = 1;
+
+    while (top > 0) {
+        struct FluxionWorkItem* item = &ctx->worklist[top - 1];
+
+        if (item->edge == item->begin || err != FLUXION_OK) {
+            /* Post-visit: every successor is already queued */
+            Node* done = item->node;
+            top--;
+            if (plan) {
+                ctx->ready_list[ctx->ready_list_count++] = done;
+                continue;
+            }
+            done->ready_next = head;
+            head = done;
+            if (!tail) tail = done;
+            queued++;
+            continue;
+        }
+
+        item->edge--;
+        Node* src = item->node;
+        size_t index = item->edge - item->begin;
+        uint32_t next_index = plan ? plan->edge_targets[item->edge] : 0;
+        Node* next = plan ? plan->nodes[next_index] : src->subscribers[item->edge];
+
+        /* Every branch reaching a join fills its own slot */
+        if (next->join) fluxion_join_deliver_from(ctx, next, src, in);
+
+        if (next->last_pulse_id == ctx->current_pulse) {
+            if (next->join) fluxion_count_transfer(ctx, src, index);
+            continue;
+        }
 
-    /* Downstream propagation to subscribers */
+        /* May move the worklist: `item` is not used past this point */
+        if (!fluxion_worklist_reserve(ctx, top + 1) ||
+            (plan && !fluxion_ready_list_reserve(ctx, ctx->ready_list_count + top + 1))) {
+            /* Unwind: nodes already activated must still be queued */
+            err = FLUXION_ERR_OUT_OF_MEMORY;
+            continue;
+        }
+
+        fluxion_count_transfer(ctx, src, index);
+        fluxion_activate(ctx, next, in);
+        fluxion_worklist_push(ctx, plan, top++, next, next_index);
+    }
+
+    if (head) {
+        tail->ready_next = ctx->ready_head;
+        ctx->ready_head = head;
+        ctx->ready_count += queued;
+    }
+
+    return err;
+}
+
+/**
+ * @brief Propagates an emission, as one span when tracing
+ */
+static FluxionError fluxion_propagate_emission(
+    FluxionContext* ctx,
+    const FluxionPlan* plan,
+    Node* target,
+    const FluxionInput* in
+) {
+    if (!ctx->tracer) return fluxion_propagate(ctx, plan, target, in);
+
+    uint64_t begin = fluxion_ticks();
+    FluxionError err = fluxion_propagate(ctx, plan, target, in);
+    fluxion_trace_record(ctx->tracer, 0, FLUXION_TRACE_PROPAGATE, target->name,
+                         ctx->current_pulse, begin, fluxion_ticks());
+    return err;
+}
+
+/* ============================================================================
+ * DATAFLOW ACTIVATION (MIN-HEAP ON TOPO_ORDER)
+ * ============================================================================
+ */
+
+static void fluxion_flow_sift_up(Node** heap, size_t i) {
+    Node* n = heap[i];
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (heap[parent]->topo_order <= n->topo_order) break;
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = n;
+}
+
+static Node* fluxion_flow_pop(FluxionContext* ctx) {
+    Node** heap = ctx->flow_heap;
+    Node* top = heap[0];
+    Node* last = heap[--ctx->flow_count];
+    size_t count = ctx->flow_count;
+
+    /* Sift the last node down from the root */
+    size_t i = 0;
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= count) break;
+        if (child + 1 < count && heap[child + 1]->topo_order < heap[child]->topo_order) child++;
+        if (last->topo_order <= heap[child]->topo_order) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    if (count > 0) heap[i] = last;
+
+    return top;
+}
+
+/**
+ * @brief Marks a node ready and schedules it by topological order
+ *
+ * A node already activated this pulse keeps its first input.
+ */
+static FluxionError fluxion_flow_activate(FluxionContext* ctx, Node* n, const FluxionInput* in) {
+    if (n->last_pulse_id == ctx->current_pulse) return FLUXION_OK;
+
+    if (ctx->flow_count == ctx->flow_capacity) {
+        size_t capacity = ctx->flow_capacity ? ctx->flow_capacity * 2 : 64;
+        Node** tmp = realloc(ctx->flow_heap, sizeof(Node*) * capacity);
+        if (!tmp) return FLUXION_ERR_OUT_OF_MEMORY;
+        ctx->flow_heap = tmp;
+        ctx->flow_capacity = capacity;
+    }
+
+    fluxion_activate(ctx, n, in);
+    ctx->flow_heap[ctx->flow_count] = n;
+    fluxion_flow_sift_up(ctx->flow_heap, ctx->flow_count++);
+    return FLUXION_OK;
+}
+
+/**
+ * @brief Activates the subscribers of `n` with an output it produced
+ *
+ * Dataflow nodes, async jobs and join firings hand their output on
+ * here; propagation from an emission does not reach these subscribers.
+ */
+static void fluxion_activate_subscribers(FluxionContext* ctx, Node* n, const FluxionInput* in) {
     for (size_t i = 0; i < n->subscriber_count; i++) {
-        fluxion_propagate(ctx, n->subscribers[i], data, depth + 1);
+        Node* s = n->subscribers[i];
+        if (s->join) fluxion_join_deliver_from(ctx, s, n, in);
+        if (s->join || s->last_pulse_id != ctx->current_pulse) fluxion_count_transfer(ctx, n, i);
+
+        FluxionError err = (ctx->policy == FLUXION_EXEC_DATAFLOW)
+            ? fluxion_flow_activate(ctx, s, in)
+            : fluxion_propagate_emission(ctx, fluxion_plan_for(ctx, s), s, in);
+        if (err != FLUXION_OK) ctx->last_error = err;
+    }
+}
+
+/* ============================================================================
+ * EMIT COALESCING
+ * ============================================================================
+ */
+
+static FluxionError fluxion_inject_now(FluxionContext* ctx, Node* target, const FluxionInput* in);
+
+/**
+ * @brief Appends a source to the held emissions (FIFO: emission order)
+ */
+static void fluxion_coalesce_enqueue(FluxionContext* ctx, Node* n) {
+    FluxionCoalesce* c = n->coalesce;
+    c->pending      = 1;
+    c->pending_next = NULL;
+    c->pending_ctx  = ctx;
+
+    if (ctx->coalesce_tail) ctx->coalesce_tail->coalesce->pending_next = n;
+    else ctx->coalesce_head = n;
+    ctx->coalesce_tail = n;
+}
+
+/**
+ * @brief Propagates every held emission whose window has elapsed
+ *
+ * Sources still inside their window stay held. Emissions made while
+ * flushing (e.g. by immediate pulses) are held for the next pulse.
+ */
+static void fluxion_flush_coalesced(FluxionContext* ctx) {
+    if (!ctx->coalesce_head || ctx->coalesce_flushing) return;
+    ctx->coalesce_flushing = 1;
+
+    Node* n = ctx->coalesce_head;
+    ctx->coalesce_head = NULL;
+    ctx->coalesce_tail = NULL;
+
+    uint64_t now = 0;
+    while (n) {
+        FluxionCoalesce* c = n->coalesce;
+        Node* next = c->pending_next;
+
+        /* The clock is read only for windowed sources */
+        if (c->window_ns && now == 0) now = fluxion_time_ns();
+
+        if (!fluxion_coalesce_due(c, now)) {
+            fluxion_coalesce_enqueue(ctx, n);
+        } else {
+            c->pending      = 0;
+            c->pending_next = NULL;
+            c->pending_ctx  = NULL;
+
+            FluxionInput in;
+            fluxion_coalesce_take(c, &ctx->arena, now, &in.data, &in.count, &in.stride, &in.msg);
+            fluxion_inject_now(ctx, n, &in);
+        }
+        n = next;
+    }
+
+    ctx->coalesce_flushing = 0;
+}
+
+/**
+ * @brief Copies held messages aside before the arena is reset
+ */
+static void fluxion_spill_coalesced(FluxionContext* ctx) {
+    for (Node* n = ctx->coalesce_head; n; n = n->coalesce->pending_next) {
+        fluxion_coalesce_spill(n->coalesce);
     }
 }
 
@@ -89,68 +721,1116 @@ static void fluxion_propagate(
  * ============================================================================
  */
 
-FluxionError fluxion_emit(FluxionContext* ctx, Node* target, void* data) {
-    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
-    if (!target) return FLUXION_ERR_INVALID_NODE;
+/**
+ * @brief Emission path: held by a coalescing source, or injected now
+ */
+static FluxionError fluxion_inject(FluxionContext* ctx, Node* target, const FluxionInput* in) {
+    FluxionCoalesce* c = target->coalesce;
+    if (!c || c->policy == FLUXION_COALESCE_NONE) return fluxion_inject_now(ctx, target, in);
+
+    FluxionError err = fluxion_coalesce_hold(c, in->data, in->count, in->stride, in->msg);
+    if (err != FLUXION_OK) {
+        ctx->last_error = err;
+        return err;
+    }
+    if (!c->pending) fluxion_coalesce_enqueue(ctx, target);
+
+    /* Immediate policy: runs as soon as the source's window allows */
+    if (ctx->policy == FLUXION_EXEC_IMMEDIATE) fluxion_flush_coalesced(ctx);
+    return FLUXION_OK;
+}
+
+/**
+ * @brief Shared emission path: propagation, then immediate execution
+ */
+static FluxionError fluxion_inject_now(FluxionContext* ctx, Node* target, const FluxionInput* in) {
+    /* Dataflow: successors are activated by outputs, once the target has run */
+    if (ctx->policy == FLUXION_EXEC_DATAFLOW) {
+        ctx->last_error = fluxion_flow_activate(ctx, target, in);
+        if (in->msg) fluxion_msg_release(in->data);
+        return ctx->last_error;
+    }
+
+    const FluxionPlan* plan = fluxion_plan_for(ctx, target);
 
-    ctx->last_error = FLUXION_OK;
+    ctx->last_error = fluxion_propagate_emission(ctx, plan, target, in);
 
-    fluxion_propagate(ctx, target, data, 0);
+    /* The emitter's reference is transferred to the reached nodes */
+    if (in->msg) fluxion_msg_release(in->data);
 
     /* Immediate policy: execute on emit */
     if (ctx->policy == FLUXION_EXEC_IMMEDIATE) {
-        Node* graph[] = { target };
-        fluxion_pulse(ctx, graph, 1);
+        if (ctx->scheduling == FLUXION_SCHED_READY_QUEUE) {
+            fluxion_pulse(ctx, NULL, 0);
+        } else if (plan) {
+            fluxion_pulse_plan(ctx, plan);
+        } else {
+            Node* graph[] = { target };
+            fluxion_pulse(ctx, graph, 1);
+        }
     }
 
     return ctx->last_error;
 }
 
-/* ============================================================================
- * PULSE EXECUTION
- * ============================================================================
+/**
+ * @brief Rejects slot-less emissions into a join
  */
+static FluxionError fluxion_reject_join(FluxionContext* ctx, Node* target) {
+    fprintf(stderr, "[Fluxion] Emit rejected: %s is a join, use fluxion_emit_slot()\n", target->name);
+    ctx->last_error = FLUXION_ERR_INVALID_ARGUMENT;
+    return ctx->last_error;
+}
 
-void fluxion_pulse(FluxionContext* ctx, Node* graph[], size_t count) {
-    if (!ctx || !graph) return;
+FluxionError fluxion_emit(FluxionContext* ctx, Node* target, void* data) {
+    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
+    if (!target) return FLUXION_ERR_INVALID_NODE;
+    if (target->join) return fluxion_reject_join(ctx, target);
 
-    size_t executed = 0;
+    FluxionInput in = { data, 0, 0, fluxion_msg_is(&ctx->arena, data) };
+    return fluxion_inject(ctx, target, &in);
+}
 
-    for (size_t i = 0; i < count; i++) {
-        Node* n = graph[i];
-        if (!n || n->state_flag != FLUXION_NODE_READY) continue;
+FluxionError fluxion_emit_batch(
+    FluxionContext* ctx,
+    Node* target,
+    void* items,
+    size_t count,
+    size_t stride
+) {
+    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
+    if (!target) return FLUXION_ERR_INVALID_NODE;
+    if (target->join) return fluxion_reject_join(ctx, target);
+    if (count == 0) return FLUXION_OK;
+    if (!items) return FLUXION_ERR_INVALID_ARGUMENT;
 
-        /* Safe execution */
-        n->state_flag = FLUXION_NODE_RUNNING;
+    /* Packed arrays of a registered type need no explicit stride */
+    if (stride == 0 && count > 1) {
+        stride = fluxion_type_size(fluxion_node_type_id(target));
+        if (stride == 0) return FLUXION_ERR_INVALID_ARGUMENT;
+    }
 
-        if (n->action) {
-            n->action(n, n->input_buffer);
-            executed++;
-        }
+    FluxionInput in = { items, count, stride, fluxion_msg_is(&ctx->arena, items) };
+    return fluxion_inject(ctx, target, &in);
+}
 
-        n->state_flag = FLUXION_NODE_SLEEPING;
+FluxionError fluxion_emit_typed(
+    FluxionContext* ctx,
+    Node* target,
+    void* data,
+    FluxionTypeId type
+) {
+    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
+    if (!target) return FLUXION_ERR_INVALID_NODE;
+
+    if (ctx->type_checks && !fluxion_type_compatible(type, fluxion_node_type_id(target))) {
+        const FluxionTypeInfo* info = fluxion_type_info(type);
+        fprintf(stderr,
+            "[Fluxion] Emit rejected: %s data into %s(%s)\n",
+            info ? info->name : "untyped",
+            target->name, target->data_type);
+        ctx->last_error = FLUXION_ERR_TYPE_MISMATCH;
+        return ctx->last_error;
     }
 
-    ctx->executed_nodes += executed;
+    return fluxion_emit(ctx, target, data);
+}
+
+FluxionError fluxion_emit_copy(FluxionContext* ctx, Node* target, const void* value) {
+    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
+    if (!target) return FLUXION_ERR_INVALID_NODE;
+    if (target->join) return fluxion_reject_join(ctx, target);
+
+    size_t size = fluxion_type_size(fluxion_node_type_id(target));
+    if (!value || size == 0) return FLUXION_ERR_INVALID_ARGUMENT;
+
+    void* msg = fluxion_msg_alloc(ctx, size);
+    if (!msg) return FLUXION_ERR_OUT_OF_MEMORY;
+
+    memcpy(msg, value, size);
+    return fluxion_emit(ctx, target, msg);
+}
+
+FluxionError fluxion_emit_slot(FluxionContext* ctx, Node* join, uint32_t slot, void* data) {
+    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
+    if (!join) return FLUXION_ERR_INVALID_NODE;
+    if (!join->join || slot >= join->join->slot_count) return FLUXION_ERR_INVALID_ARGUMENT;
 
-    if (executed == 0) {
-        ctx->last_error = FLUXION_ERR_CYCLE_DETECTED;
+    FluxionInput in = { data, 0, 0, fluxion_msg_is(&ctx->arena, data) };
+    fluxion_join_deliver(join->join, slot, data, in.msg, ctx->current_pulse);
+    return fluxion_inject(ctx, join, &in);
+}
+
+/* ============================================================================
+ * MESSAGES
+ * ============================================================================
+ */
+
+void* fluxion_msg_alloc(FluxionContext* ctx, size_t size) {
+    if (!ctx) return NULL;
+    return fluxion_msg_create(&ctx->arena, size);
+}
+
+void* fluxion_msg_write(Node* self, void* data) {
+    if (!self || !data || !self->input_origin || data != self->input_buffer) return data;
+
+    /* Sole reader: write in place, still handed on as this node's rewrite */
+    if (fluxion_msg_refs(data) <= 1) {
+        self->input_writer = self->topo_order;
+        return data;
     }
 
-    ctx->current_pulse++;
+    void* copy = fluxion_msg_clone(data);
+    if (!copy) return NULL;
+
+    fluxion_msg_release(data);
+    self->input_buffer = copy;
+    return copy;
 }
 
 /* ============================================================================
- * RUNTIME RESET
+ * NODE STATE (SLAB)
  * ============================================================================
  */
 
-void fluxion_reset(FluxionContext* ctx) {
-    if (!ctx) return;
+FluxionError fluxion_pack_state(FluxionContext* ctx, const FluxionPlan* plan) {
+    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
+    if (!plan) return FLUXION_ERR_INVALID_ARGUMENT;
 
-    ctx->current_pulse  = 1;
+    FluxionSlab* slab = &ctx->state_slab;
+
+    /* Pass 1: size of the packed region */
+    size_t total = 0;
+    size_t packed = 0;
+    for (uint32_t i = 0; i < plan->node_count; i++) {
+        const Node* n = plan->nodes[i];
+        size_t block = n->state ? fluxion_slab_block_size(n->state_size) : 0;
+        total += block;
+        packed += block ? 1 : 0;
+    }
+
+    unsigned char* region = NULL;
+    if (total > 0) {
+        region = fluxion_slab_alloc_region(slab, total);
+        if (!region) return FLUXION_ERR_OUT_OF_MEMORY;
+        fluxion_slab_adopt(slab, packed);
+    }
+
+    /* Pass 2: move the states, in topological order */
+    size_t offset = 0;
+    for (uint32_t i = 0; i < plan->node_count; i++) {
+        Node* n = plan->nodes[i];
+        size_t block = n->state ? fluxion_slab_block_size(n->state_size) : 0;
+
+        if (block == 0) {
+            /* No state yet, or too large for a class */
+            fluxion_node_bind_slab(n, slab);
+            continue;
+        }
+
+        void* old = n->state;
+        struct FluxionSlab* old_slab = n->state_slab;
+
+        memcpy(region + offset, old, n->state_size);
+        n->state = region + offset;
+        n->state_slab = slab;
+        offset += block;
+
+        if (old_slab) fluxion_slab_free(old_slab, old, n->state_size);
+        else free(old);
+    }
+
+    return FLUXION_OK;
+}
+
+/* ============================================================================
+ * PULSE EXECUTION
+ * ============================================================================
+ */
+
+/* Claims a subscriber's input while its rewrite is being swapped */
+#define FLUXION_WRITER_BUSY INT64_MAX
+
+/**
+ * @brief Hands a node's rewritten message to its pending subscribers
+ *
+ * Only subscribers still holding the same emission are updated, so a
+ * branch that did not write never overrides a sibling's output. When
+ * several parents rewrite it, the one latest in topological order wins
+ * whatever the order they ran in: parallel levels give the same input
+ * as a serial pulse.
+ */
+static void fluxion_forward_output(FluxionContext* ctx, Node* n, void* out) {
+    for (size_t i = 0; i < n->subscriber_count; i++) {
+        Node* s = n->subscribers[i];
+        if (s->join) fluxion_join_rewrite(s->join, n, n->input_origin, out, ctx->current_pulse);
+
+        if (s->last_pulse_id != ctx->current_pulse ||
+            s->state_flag != FLUXION_NODE_READY ||
+            s->input_origin != n->input_origin) continue;
+
+        /* Same-level parents may race here: the rank doubles as a lock */
+        int64_t writer = __atomic_load_n(&s->input_writer, __ATOMIC_ACQUIRE);
+        for (;;) {
+            if (writer == FLUXION_WRITER_BUSY) {
+                writer = __atomic_load_n(&s->input_writer, __ATOMIC_ACQUIRE);
+                continue;
+            }
+            if (writer >= n->topo_order) break;
+            if (__atomic_compare_exchange_n(&s->input_writer, &writer, FLUXION_WRITER_BUSY, 0,
+                                            __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) break;
+        }
+        if (writer >= n->topo_order) continue;
+
+        fluxion_msg_retain(out);
+        void* previous = s->input_buffer;
+        s->input_buffer = out;
+        __atomic_store_n(&s->input_writer, n->topo_order, __ATOMIC_RELEASE);
+        fluxion_msg_release(previous);
+    }
+}
+
+/**
+ * @brief Runs a flow_action on the node's input
+ *
+ * A batch runs item by item and moves on as a whole if any item
+ * produced an output.
+ */
+static inline void* fluxion_call_flow(Node* n) {
+    if (n->input_count == 0) return n->flow_action(n, n->input_buffer);
+
+    void* out = FLUXION_NO_OUTPUT;
+    char* item = n->input_buffer;
+    for (size_t i = 0; i < n->input_count; i++, item += n->input_stride) {
+        if (n->flow_action(n, item) != FLUXION_NO_OUTPUT) out = n->input_buffer;
+    }
+    return out;
+}
+
+/**
+ * @brief Runs a join_action if the join's firing policy is met
+ *
+ * A join without slots behaves as a single slot holding its input.
+ * When `forward` is set, a returned slot message keeps the slot's
+ * reference as the output's own.
+ *
+ * @return 1 if the join fired, 0 otherwise
+ */
+static inline size_t fluxion_call_join(Node* n, int forward, void** out) {
+    FluxionJoin* j = n->join;
+    *out = FLUXION_NO_OUTPUT;
+
+    if (!j) {
+        *out = n->join_action(n, &n->input_buffer, 1);
+        return 1;
+    }
+
+    uint32_t fresh = fluxion_join_ready(j, n->last_pulse_id);
+    if (!fresh) return 0;
+
+    *out = n->join_action(n, j->slots, fresh);
+
+    void* held = n->input_origin ? n->input_buffer : NULL;
+    fluxion_join_consume(j, (forward && *out != held) ? *out : NULL);
+    return 1;
+}
+
+/**
+ * @brief Activates the subscribers with a node's output, then drops its input
+ *
+ * `out` is FLUXION_NO_OUTPUT (subscribers stay asleep), the node's
+ * input, or a payload the node returned. A returned message carries
+ * one reference, handed to the subscribers.
+ */
+static void fluxion_hand_output(FluxionContext* ctx, Node* n, void* out) {
+    void* held = n->input_origin ? n->input_buffer : NULL;  // This reader's reference
+    int out_msg = out && (out == held || fluxion_msg_is(&ctx->arena, out));
+
+    if (out != FLUXION_NO_OUTPUT) {
+        FluxionInput next = { out, 0, 0, out_msg };
+        if (out == n->input_buffer) {
+            next.count  = n->input_count;
+            next.stride = n->input_stride;
+        }
+        fluxion_activate_subscribers(ctx, n, &next);
+    }
+
+    if (out_msg) fluxion_msg_release(out);
+    if (held && held != out) fluxion_msg_release(held);
+}
+
+/**
+ * @brief Calls the action or batch action of a node on its input
+ * @return 1 if an action was executed, 0 otherwise
+ */
+static inline size_t fluxion_call_action(Node* n) {
+    size_t executed = 0;
+
+    /* Dataflow logic outside dataflow mode: subscribers are already active */
+    if (!n->action && !n->batch_action && n->flow_action) {
+        fluxion_call_flow(n);
+        return 1;
+    }
+
+    if (n->input_count == 0) {
+        if (n->action) {
+            n->action(n, n->input_buffer);
+            executed = 1;
+        } else if (n->batch_action) {
+            n->batch_action(n, n->input_buffer, 1, 0);
+            executed = 1;
+        }
+    } else if (n->batch_action) {
+        /* One call for the whole span */
+        n->batch_action(n, n->input_buffer, n->input_count, n->input_stride);
+        executed = 1;
+    } else if (n->action) {
+        /* Fallback: the scalar logic runs once per item */
+        char* item = n->input_buffer;
+        for (size_t i = 0; i < n->input_count; i++, item += n->input_stride) {
+            n->action(n, item);
+        }
+        executed = 1;
+    }
+
+    return executed;
+}
+
+/**
+ * @brief Hands an async node's input to the I/O workers
+ * @return 1 if the job was submitted, 0 otherwise
+ */
+static size_t fluxion_call_async(FluxionContext* ctx, Node* n) {
+    FluxionError err = fluxion_async_submit(ctx, n);
+    if (err == FLUXION_OK) return 1;
+
+    fprintf(stderr, "[Fluxion] Async submission failed for node '%s' (error %d)\n", n->name, (int)err);
+    return 0;
+}
+
+/**
+ * @brief Runs a single ready node
+ * @return 1 if an action was executed, 0 otherwise
+ */
+static inline size_t fluxion_run_node(FluxionContext* ctx, Node* n) {
+    /* Safe execution */
+    n->state_flag = FLUXION_NODE_RUNNING;
+
+    /* Join logic: runs on the slots, its output wakes the subscribers */
+    if (n->join_action) {
+        void* out;
+        size_t executed = fluxion_call_join(n, 1, &out);
+        fluxion_hand_output(ctx, n, out);
+        n->state_flag = FLUXION_NODE_SLEEPING;
+        return executed;
+    }
+
+    size_t executed = n->async_action
+        ? fluxion_call_async(ctx, n)
+        : fluxion_call_action(n);
+
+    /* Messages: forward a copy-on-write output, then drop this reader */
+    if (n->input_origin) {
+        void* out = n->input_buffer;
+        if (out != n->input_origin || n->input_writer == n->topo_order) fluxion_forward_output(ctx, n, out);
+        fluxion_msg_release(out);
+    }
+
+    n->state_flag = FLUXION_NODE_SLEEPING;
+    return executed;
+}
+
+/**
+ * @brief Runs a ready node on a trace lane, timed when tracing or profiling
+ */
+static inline size_t fluxion_run_lane(FluxionContext* ctx, Node* n, unsigned lane) {
+    return (ctx->tracer || ctx->profiling) ? fluxion_trace_run(ctx, n, lane, fluxion_run_node) : fluxion_run_node(ctx, n);
+}
+
+/**
+ * @brief Runs a ready node on the pulse's thread, recording its class latency
+ */
+static inline size_t fluxion_run_serial_node(FluxionContext* ctx, Node* n) {
+    ctx->running_nodes++;
+    size_t executed = fluxion_run_lane(ctx, n, 0);
+    ctx->running_nodes--;
+    if (executed && ctx->class_stats) fluxion_class_record(ctx, n, fluxion_time_ns() - ctx->pulse_start_ns);
+    return executed;
+}
+
+/**
+ * @brief Runs every node of the ready queue, in queue order
+ *
+ * Nodes activated by actions during the pulse are appended to a fresh
+ * queue and executed before the pulse ends.
+ */
+static size_t fluxion_run_ready_queue(FluxionContext* ctx) {
+    size_t executed = 0;
+
+    while (fluxion_ready_pending(ctx)) {
+        Node* n = ctx->ready_head;
+        ctx->ready_head  = NULL;
+        ctx->ready_count = 0;
+
+        while (n) {
+            Node* next = n->ready_next;
+            n->ready_next = NULL;
+            if (n->state_flag == FLUXION_NODE_READY) executed += fluxion_run_serial_node(ctx, n);
+            n = next;
+        }
+    }
+
+    return executed;
+}
+
+/**
+ * @brief Lets go of the message input of a node that did not run
+ *
+ * Its pulse-arena message is about to be recycled: the node stays
+ * ready, but runs on a NULL input unless it is activated again.
+ */
+static inline void fluxion_detach_input(Node* n) {
+    if (n->state_flag != FLUXION_NODE_READY || !n->input_origin) return;
+
+    fluxion_msg_release(n->input_origin);
+    n->input_buffer = NULL;
+    n->input_count  = 0;
+    n->input_stride = 0;
+    n->input_origin = NULL;
+}
+
+/**
+ * @brief Forgets queued activations (full-scan mode bookkeeping)
+ */
+static void fluxion_drop_ready_queue(FluxionContext* ctx) {
+    fluxion_splice_ready_list(ctx);
+    for (Node* n = ctx->ready_head; n; n = n->ready_next) fluxion_detach_input(n);
+
+    ctx->ready_head  = NULL;
+    ctx->ready_count = 0;
+}
+
+/**
+ * @brief Runs the plan ready list, newest batch first
+ *
+ * The list is swapped out before it runs: nodes that actions activate
+ * go to a fresh list, run by the caller's next round.
+ */
+static size_t fluxion_run_ready_list(FluxionContext* ctx) {
+    Node** batch = ctx->ready_list;
+    size_t count = ctx->ready_list_count;
+    size_t capacity = ctx->ready_list_capacity;
+
+    ctx->ready_list = ctx->ready_spare;
+    ctx->ready_list_capacity = ctx->ready_spare_capacity;
+    ctx->ready_list_count = 0;
+    ctx->ready_spare = NULL;
+    ctx->ready_spare_capacity = 0;
+
+    /* Reverse post-order: independent loads, no ready_next chasing */
+    size_t executed = 0;
+    for (size_t i = count; i-- > 0;) {
+        Node* n = batch[i];
+        if (n->state_flag == FLUXION_NODE_READY) executed += fluxion_run_serial_node(ctx, n);
+    }
+
+    /* Keep the larger buffer for the next swap */
+    if (capacity > ctx->ready_spare_capacity) {
+        free(ctx->ready_spare);
+        ctx->ready_spare = batch;
+        ctx->ready_spare_capacity = capacity;
+    } else {
+        free(batch);
+    }
+    return executed;
+}
+
+/**
+ * @brief Runs the ready nodes of a plan, keeping the others queued in order
+ *
+ * O(ready): nodes reached through the plan come from the ready list;
+ * the queue only holds activations that bypassed it. Queued nodes
+ * outside the plan wait for the next pulse, without their message input.
+ */
+static size_t fluxion_run_plan_ready(FluxionContext* ctx, const FluxionPlan* plan) {
+    size_t executed = 0;
+    Node* kept = NULL;
+    Node** link = &kept;
+    size_t kept_count = 0;
+
+    while (ctx->ready_list_count || ctx->ready_head) {
+        if (ctx->ready_list_count) {
+            if (ctx->ready_list_plan == plan) {
+                executed += fluxion_run_ready_list(ctx);
+                continue;
+            }
+            fluxion_splice_ready_list(ctx);
+        }
+
+        Node* n = ctx->ready_head;
+        ctx->ready_head  = NULL;
+        ctx->ready_count = 0;
+
+        while (n) {
+            Node* next = n->ready_next;
+            n->ready_next = NULL;
+            if (n->state_flag == FLUXION_NODE_READY) {
+                if (fluxion_plan_contains(plan, n)) {
+                    executed += fluxion_run_serial_node(ctx, n);
+                } else {
+                    fluxion_detach_input(n);
+                    *link = n;
+                    link = &n->ready_next;
+                    kept_count++;
+                }
+            }
+            n = next;
+        }
+    }
+
+    ctx->ready_head  = kept;
+    ctx->ready_count = kept_count;
+    return executed;
+}
+
+/* ============================================================================
+ * PARALLEL EXECUTION (LEVEL SCHEDULE)
+ * ============================================================================
+ */
+
+/**
+ * @brief Pool task: runs one node of a level
+ */
+static size_t fluxion_parallel_task(void* arg, Node* n, unsigned worker) {
+    /* Joins activate their subscribers: they run on the pulse's thread */
+    if (n->state_flag != FLUXION_NODE_READY || n->join_action) return 0;
+
+    /* Workers past the last pool lane are counted as lost */
+    return fluxion_run_lane(arg, n, (worker < FLUXION_TRACE_ASYNC_LANE) ? worker : FLUXION_TRACE_LANES);
+}
+
+/**
+ * @brief Grows a scratch array geometrically (never shrinks)
+ * @return The (possibly moved) array, or NULL if it could not grow
+ */
+static void* fluxion_scratch_reserve(void* buffer, size_t* capacity, size_t needed, size_t item) {
+    if (needed <= *capacity) return buffer;
+
+    size_t grown = *capacity ? *capacity : 64;
+    while (grown < needed) grown *= 2;
+
+    void* tmp = realloc(buffer, grown * item);
+    if (!tmp) return NULL;
+
+    *capacity = grown;
+    return tmp;
+}
+
+/**
+ * @brief Runs the ready queue level by level
+ *
+ * The queue is topologically ordered, so one pass computes each node's
+ * longest distance from a source of the pulse (its level). Two ready
+ * nodes of the same level cannot be linked, hence a level can run
+ * concurrently; the pool returns only when a level is complete.
+ */
+static size_t fluxion_run_parallel(FluxionContext* ctx) {
+    size_t executed = 0;
+
+    while (fluxion_ready_pending(ctx)) {
+        size_t count = ctx->ready_count;
+
+        Node** schedule = fluxion_scratch_reserve(ctx->schedule, &ctx->schedule_capacity,
+                                                  count * 2, sizeof(Node*));
+        if (!schedule) return executed + fluxion_run_ready_queue(ctx);
+        ctx->schedule = schedule;
+
+        Node** order  = ctx->schedule;
+        Node** sorted = ctx->schedule + count;
+
+        /* --- Detach the queue --- */
+        size_t n_ready = 0;
+        for (Node* n = ctx->ready_head; n && n_ready < count; n = n->ready_next) {
+            n->sched_level = 0;
+            order[n_ready++] = n;
+        }
+        ctx->ready_head  = NULL;
+        ctx->ready_count = 0;
+
+        /* --- Levels: longest path from the pulse sources --- */
+        uint32_t depth = 1;
+        for (size_t i = 0; i < n_ready; i++) {
+            Node* n = order[i];
+            n->ready_next = NULL;
+
+            for (size_t j = 0; j < n->subscriber_count; j++) {
+                Node* s = n->subscribers[j];
+                if (s->state_flag != FLUXION_NODE_READY ||
+                    s->last_pulse_id != ctx->current_pulse) continue;
+
+                if (s->sched_level <= n->sched_level) {
+                    s->sched_level = n->sched_level + 1;
+                    if (s->sched_level + 1 > depth) depth = s->sched_level + 1;
+                }
+            }
+        }
+
+        uint32_t* levels = fluxion_scratch_reserve(ctx->levels, &ctx->levels_capacity,
+                                                   (size_t)depth + 1, sizeof(uint32_t));
+        if (!levels) {
+            for (size_t i = 0; i < n_ready; i++) {
+                if (order[i]->state_flag == FLUXION_NODE_READY) executed += fluxion_run_lane(ctx, order[i], 0);
+            }
+            continue;
+        }
+        ctx->levels = levels;
+
+        /* --- Counting sort by level (stable: keeps topological order) --- */
+        for (uint32_t l = 0; l <= depth; l++) levels[l] = 0;
+        for (size_t i = 0; i < n_ready; i++) levels[order[i]->sched_level + 1]++;
+        for (uint32_t l = 0; l < depth; l++) levels[l + 1] += levels[l];
+        for (size_t i = 0; i < n_ready; i++) sorted[levels[order[i]->sched_level]++] = order[i];
+
+        /* After placement, level l spans [l ? levels[l - 1] : 0, levels[l]) */
+        size_t begin = 0;
+        for (uint32_t l = 0; l < depth; l++) {
+            size_t end  = levels[l];
+            size_t span = end - begin;
+
+            /* The level is running as a whole (metrics) */
+            ctx->running_nodes = span;
+            if (ctx->deterministic || !ctx->pool || span < 2) {
+                for (size_t i = begin; i < end; i++) {
+                    if (sorted[i]->state_flag == FLUXION_NODE_READY) executed += fluxion_run_lane(ctx, sorted[i], 0);
+                }
+            } else {
+                executed += fluxion_pool_run(ctx->pool, sorted + begin, span,
+                                             fluxion_parallel_task, ctx);
+                for (size_t i = begin; i < end; i++) {
+                    Node* n = sorted[i];
+                    if (n->join_action && n->state_flag == FLUXION_NODE_READY) executed += fluxion_run_lane(ctx, n, 0);
+                }
+            }
+            ctx->running_nodes = 0;
+
+            begin = end;
+        }
+    }
+
+    return executed;
+}
+
+/* ============================================================================
+ * ORDERED EXECUTION (LIST SCHEDULE)
+ * ============================================================================
+ */
+
+#define FLUXION_DEADLINE_MAX ((UINT64_C(1) << 62) - 1)
+
+/**
+ * @brief Own urgency of a node: the lower, the sooner
+ *
+ * Class rank and deadline share one integer, compared in a single
+ * test: PRIORITY puts the class in the top bits, DEADLINE in the
+ * bottom ones.
+ */
+static inline uint64_t fluxion_order_key(const FluxionContext* ctx, const Node* n) {
+    uint64_t rank = FLUXION_PRIORITY_CRITICAL - (n->priority > FLUXION_PRIORITY_CRITICAL
+                                                 ? FLUXION_PRIORITY_CRITICAL : n->priority);
+    uint64_t deadline = (n->deadline_ns && n->deadline_ns < FLUXION_DEADLINE_MAX)
+        ? n->deadline_ns : FLUXION_DEADLINE_MAX;
+
+    return (ctx->ordering == FLUXION_ORDER_PRIORITY) ? (rank << 62) | deadline : (deadline << 2) | rank;
+}
+
+/**
+ * @brief Is `n` part of the batch being scheduled?
+ */
+static inline int fluxion_order_member(const FluxionContext* ctx, const Node* n) {
+    return n->state_flag == FLUXION_NODE_READY && n->last_pulse_id == ctx->current_pulse;
+}
+
+static inline int fluxion_order_before(const Node* a, const Node* b) {
+    return a->sched_key < b->sched_key ||
+           (a->sched_key == b->sched_key && a->topo_order < b->topo_order);
+}
+
+static void fluxion_order_push(Node** heap, size_t* count, Node* n) {
+    size_t i = (*count)++;
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (!fluxion_order_before(n, heap[parent])) break;
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = n;
+}
+
+static Node* fluxion_order_pop(Node** heap, size_t* count) {
+    Node* top = heap[0];
+    Node* last = heap[--(*count)];
+    size_t n = *count;
+
+    size_t i = 0;
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= n) break;
+        if (child + 1 < n && fluxion_order_before(heap[child + 1], heap[child])) child++;
+        if (!fluxion_order_before(heap[child], last)) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    if (n > 0) heap[i] = last;
+
+    return top;
+}
+
+/**
+ * @brief Runs the ready queue most urgent first, predecessors before successors
+ *
+ * sched_level counts the ready predecessors a node still waits for;
+ * nodes without any sit in a min-heap on their urgency. Urgency is
+ * inherited backwards (the queue is topologically ordered), so a
+ * bulk node feeding a critical one is as urgent as that node.
+ */
+static size_t fluxion_run_ordered(FluxionContext* ctx) {
+    size_t executed = 0;
+
+    while (fluxion_ready_pending(ctx)) {
+        size_t count = ctx->ready_count;
+
+        Node** schedule = fluxion_scratch_reserve(ctx->schedule, &ctx->schedule_capacity,
+                                                  count * 2, sizeof(Node*));
+        if (!schedule) return executed + fluxion_run_ready_queue(ctx);
+        ctx->schedule = schedule;
+
+        Node** order = ctx->schedule;
+        Node** heap  = ctx->schedule + count;
+
+        /* --- Detach the queue --- */
+        size_t n_ready = 0;
+        for (Node* n = ctx->ready_head; n && n_ready < count; n = n->ready_next) {
+            n->sched_level = 0;
+            n->sched_key   = fluxion_order_key(ctx, n);
+            order[n_ready++] = n;
+        }
+        ctx->ready_head  = NULL;
+        ctx->ready_count = 0;
+
+        /* --- Ready predecessors of each node --- */
+        for (size_t i = 0; i < n_ready; i++) {
+            Node* n = order[i];
+            n->ready_next = NULL;
+            for (size_t j = 0; j < n->subscriber_count; j++) {
+                if (fluxion_order_member(ctx, n->subscribers[j])) n->subscribers[j]->sched_level++;
+            }
+        }
+
+        /* --- Priority inheritance, successors first --- */
+        for (size_t i = n_ready; i-- > 0;) {
+            Node* n = order[i];
+            for (size_t j = 0; j < n->subscriber_count; j++) {
+                Node* s = n->subscribers[j];
+                if (fluxion_order_member(ctx, s) && s->sched_key < n->sched_key) n->sched_key = s->sched_key;
+            }
+        }
+
+        /* --- List schedule --- */
+        size_t pending = 0;
+        for (size_t i = 0; i < n_ready; i++) {
+            if (order[i]->sched_level == 0) fluxion_order_push(heap, &pending, order[i]);
+        }
+
+        while (pending > 0) {
+            Node* n = fluxion_order_pop(heap, &pending);
+            if (n->state_flag == FLUXION_NODE_READY) executed += fluxion_run_serial_node(ctx, n);
+
+            for (size_t j = 0; j < n->subscriber_count; j++) {
+                Node* s = n->subscribers[j];
+                if (!fluxion_order_member(ctx, s) || s->sched_level == 0) continue;
+                if (--s->sched_level == 0 && pending < count) fluxion_order_push(heap, &pending, s);
+            }
+        }
+
+        /* Nodes the schedule could not release (e.g. cycles built by hand) */
+        for (size_t i = 0; i < n_ready; i++) {
+            if (fluxion_order_member(ctx, order[i])) executed += fluxion_run_serial_node(ctx, order[i]);
+        }
+    }
+
+    return executed;
+}
+
+/**
+ * @brief Runs the ready queue on the pulse's thread, in the context's ordering
+ */
+static inline size_t fluxion_run_serial(FluxionContext* ctx) {
+    return (ctx->ordering == FLUXION_ORDER_TOPOLOGICAL)
+        ? fluxion_run_ready_queue(ctx)
+        : fluxion_run_ordered(ctx);
+}
+
+/* ============================================================================
+ * DATAFLOW EXECUTION
+ * ============================================================================
+ */
+
+/**
+ * @brief Runs a node, then activates its subscribers if it has an output
+ * @return 1 if an action was executed, 0 otherwise
+ */
+static size_t fluxion_run_flow_node(FluxionContext* ctx, Node* n) {
+    n->state_flag = FLUXION_NODE_RUNNING;
+
+    size_t executed = 1;
+    void* out;
+    if (n->join_action) {
+        executed = fluxion_call_join(n, 1, &out);
+    } else if (n->async_action) {
+        /* The output is activated by the pulse delivering the job */
+        executed = fluxion_call_async(ctx, n);
+        out = FLUXION_NO_OUTPUT;
+    } else if (n->flow_action) {
+        out = fluxion_call_flow(n);
+    } else {
+        /* Plain actions forward their input (or its copy-on-write copy) */
+        executed = fluxion_call_action(n);
+        out = n->input_buffer;
+    }
+
+    fluxion_hand_output(ctx, n, out);
+
+    n->state_flag = FLUXION_NODE_SLEEPING;
+    return executed;
+}
+
+/**
+ * @brief Runs ready nodes by increasing topological order
+ *
+ * A node is popped only once every node that could activate it has
+ * run: its predecessors have lower orders.
+ */
+static size_t fluxion_run_dataflow(FluxionContext* ctx) {
+    size_t executed = 0;
+
+    while (ctx->flow_count > 0) {
+        Node* n = fluxion_flow_pop(ctx);
+        if (n->state_flag != FLUXION_NODE_READY) continue;
+
+        ctx->running_nodes++;
+        size_t ran = (ctx->tracer || ctx->profiling)
+            ? fluxion_trace_run(ctx, n, 0, fluxion_run_flow_node)
+            : fluxion_run_flow_node(ctx, n);
+        ctx->running_nodes--;
+        if (ran && ctx->class_stats) fluxion_class_record(ctx, n, fluxion_time_ns() - ctx->pulse_start_ns);
+        executed += ran;
+    }
+
+    return executed;
+}
+
+/* ============================================================================
+ * ASYNC DELIVERY
+ * ============================================================================
+ */
+
+/**
+ * @brief Activates the subscribers of an async node with its job's output
+ *
+ * An output returning the job's copy of a message is handed on as a
+ * message of this pulse.
+ */
+static void fluxion_deliver_output(FluxionContext* ctx, FluxionAsyncJob* job) {
+    Node* n = job->node;
+    FluxionInput in = { job->output, 0, 0, 0 };
+
+    if (job->output == job->data) {
+        in.count  = job->count;
+        in.stride = job->stride;
+    }
+    if (job->copy && job->output == job->copy) {
+        in.data = fluxion_msg_alloc(ctx, job->copy_size);
+        if (!in.data) {
+            ctx->last_error = FLUXION_ERR_OUT_OF_MEMORY;
+            return;
+        }
+        memcpy(in.data, job->copy, job->copy_size);
+        in.msg = 1;
+    }
+
+    fluxion_activate_subscribers(ctx, n, &in);
+
+    /* The allocation's reference is transferred to the reached nodes */
+    if (in.msg) fluxion_msg_release(in.data);
+}
+
+/**
+ * @brief Delivers the completed jobs, at most one per node
+ */
+static void fluxion_deliver_async(FluxionContext* ctx) {
+    FluxionAsyncJob* job = fluxion_async_take(ctx->async);
+
+    while (job) {
+        FluxionAsyncJob* next = job->next;
+        FluxionAsyncNode* strand = job->node->async;
+
+        if (strand->delivered_pulse == ctx->current_pulse) {
+            /* Subscribers activated once per pulse: the next pulse takes it */
+            fluxion_async_defer(ctx->async, job);
+        } else {
+            strand->delivered_pulse = ctx->current_pulse;
+            if (job->timed && ctx->tracer) {
+                fluxion_trace_record(ctx->tracer, FLUXION_TRACE_ASYNC_LANE + job->worker, FLUXION_TRACE_ASYNC,
+                                     job->node->name, job->pulse_id, job->run_begin, job->run_end);
+            }
+            if (job->timed && ctx->profiling) {
+                fluxion_profile_job(job->node, job->submit_ticks, job->run_begin, job->run_end);
+            }
+            if (job->output != FLUXION_NO_OUTPUT) fluxion_deliver_output(ctx, job);
+            fluxion_async_done(ctx->async, job);
+        }
+        job = next;
+    }
+}
+
+/**
+ * @brief Closes a pulse: statistics and pulse identifier
+ */
+static void fluxion_end_pulse(FluxionContext* ctx, size_t executed) {
+    ctx->executed_nodes += executed;
+
+    /* Efficiency window: activations since the previous pulse ended */
+    ctx->pulse_ready    = ctx->activated_nodes - ctx->activated_mark;
+    ctx->pulse_executed = executed;
+    ctx->activated_mark = ctx->activated_nodes;
+
+    if (ctx->log) fluxion_log_pulse(ctx);
+    if (ctx->tracer) fluxion_trace_pulse(ctx->tracer, ctx->current_pulse);
+
+    /* Messages of the pulse are freed in bulk, except held ones */
+    if (ctx->coalesce_head) fluxion_spill_coalesced(ctx);
+    fluxion_arena_reset(&ctx->arena);
+
+    ctx->current_pulse++;
+    if (ctx->shm) fluxion_shm_pulse(ctx);
+}
+
+/**
+ * @brief Runs a pulse with the given scheduling
+ */
+static void fluxion_pulse_run(FluxionContext* ctx, Node* graph[], size_t count, FluxionScheduling scheduling) {
+    if (ctx->class_stats) ctx->pulse_start_ns = fluxion_time_ns();
+    if (ctx->log) fluxion_log_begin(ctx->log);
+    if (ctx->tracer) fluxion_trace_begin(ctx->tracer);
+    fluxion_flush_coalesced(ctx);
+    if (ctx->async) fluxion_deliver_async(ctx);
+
+    /* Queue consumers below see the plan's activations too */
+    fluxion_splice_ready_list(ctx);
+
+    size_t executed = 0;
+
+    if (ctx->policy == FLUXION_EXEC_DATAFLOW) {
+        executed = fluxion_run_dataflow(ctx);
+    } else if (scheduling == FLUXION_SCHED_READY_QUEUE) {
+        executed = (ctx->policy == FLUXION_EXEC_PARALLEL)
+            ? fluxion_run_parallel(ctx)
+            : fluxion_run_serial(ctx);
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            Node* n = graph[i];
+            if (!n || n->state_flag != FLUXION_NODE_READY) continue;
+            executed += fluxion_run_serial_node(ctx, n);
+        }
+
+        fluxion_drop_ready_queue(ctx);
+    }
+
+    fluxion_end_pulse(ctx, executed);
+}
+
+void fluxion_pulse(FluxionContext* ctx, Node* graph[], size_t count) {
+    if (!ctx) return;
+
+    /* Full scan needs the graph: reject it before any pulse bookkeeping */
+    if (!graph && ctx->policy != FLUXION_EXEC_DATAFLOW &&
+        ctx->scheduling == FLUXION_SCHED_FULL_SCAN) return;
+
+    fluxion_pulse_run(ctx, graph, count, ctx->scheduling);
+}
+
+void fluxion_pulse_ready(FluxionContext* ctx) {
+    if (!ctx) return;
+    fluxion_pulse_run(ctx, NULL, 0, FLUXION_SCHED_READY_QUEUE);
+}
+
+void fluxion_pulse_plan(FluxionContext* ctx, const FluxionPlan* plan) {
+    if (!ctx || !plan) return;
+
+    /* A stale plan may miss nodes: run what the queue holds instead */
+    if (!fluxion_plan_is_current(plan)) {
+        fprintf(stderr, "[Fluxion] Stale plan not walked: the graph changed since it was compiled\n");
+        if (ctx->plan == plan) ctx->plan = NULL;
+        fluxion_pulse_ready(ctx);
+        ctx->last_error = FLUXION_ERR_INVALID_ARGUMENT;
+        return;
+    }
+
+    if (ctx->class_stats) ctx->pulse_start_ns = fluxion_time_ns();
+    if (ctx->log) fluxion_log_begin(ctx->log);
+    if (ctx->tracer) fluxion_trace_begin(ctx->tracer);
+    fluxion_flush_coalesced(ctx);
+    if (ctx->async) fluxion_deliver_async(ctx);
+
+    size_t executed = 0;
+
+    if (ctx->policy == FLUXION_EXEC_DATAFLOW) {
+        executed = fluxion_run_dataflow(ctx);
+    } else if (ctx->scheduling == FLUXION_SCHED_READY_QUEUE) {
+        executed = fluxion_run_plan_ready(ctx, plan);
+    } else {
+        Node** nodes = plan->nodes;
+
+        /* Full scan: topological order guarantees producers run first */
+        for (uint32_t i = 0; i < plan->node_count; i++) {
+            Node* n = nodes[i];
+            if (n->state_flag != FLUXION_NODE_READY) continue;
+            executed += fluxion_run_serial_node(ctx, n);
+        }
+
+        fluxion_drop_ready_queue(ctx);
+    }
+
+    fluxion_end_pulse(ctx, executed);
+}
+
+/* ============================================================================
+ * RUNTIME RESET
+ * ============================================================================
+ */
+
+void fluxion_reset(FluxionContext* ctx) {
+    if (!ctx) return;
+
+    ctx->current_pulse  = 1;
     ctx->executed_nodes = 0;
     ctx->last_error     = FLUXION_OK;
+    ctx->flow_count     = 0;
+
+    ctx->activated_nodes = 0;
+    ctx->edge_transfers  = 0;
+    ctx->pulse_ready     = 0;
+    ctx->pulse_executed  = 0;
+    ctx->activated_mark  = 0;
+
+    fluxion_drop_ready_queue(ctx);
+    fluxion_drop_coalesced(ctx);
+}
+
+uint64_t fluxion_time_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
 }
 
 /* ============================================================================
@@ -161,16 +1841,26 @@ void fluxion_reset(FluxionContext* ctx) {
 void fluxion_runtime_debug(const FluxionContext* ctx) {
     if (!ctx) return;
 
-    const char* policy = (ctx->policy == FLUXION_EXEC_IMMEDIATE) ? "IMMEDIATE" : "DEFERRED";
+    const char* policy = fluxion_policy_name(ctx->policy);
+    const char* scheduling = (ctx->scheduling == FLUXION_SCHED_FULL_SCAN) ? "FULL_SCAN" : "READY_QUEUE";
 
     printf("[Fluxion::Runtime]\n"
            "  Current Pulse  : %llu\n"
            "  Executed Nodes : %llu\n"
            "  Last Error     : %d\n"
-           "  Policy         : %s\n\n",
-           ctx->current_pulse,
-           ctx->executed_nodes,
+           "  Policy         : %s\n"
+           "  Scheduling     : %s (%zu queued)\n"
+           "  Workers        : %u%s\n"
+           "  Plan           : %u nodes / %u edges\n\n",
+           (unsigned long long)ctx->current_pulse,
+           (unsigned long long)ctx->executed_nodes,
            ctx->last_error,
-           policy
+           policy,
+           scheduling,
+           ctx->ready_count + ctx->ready_list_count,
+           ctx->pool ? fluxion_pool_size(ctx->pool) : 1,
+           ctx->deterministic ? " (deterministic)" : "",
+           ctx->plan ? ctx->plan->node_count : 0,
+           ctx->plan ? ctx->plan->edge_count : 0
     );
 }
@@ -0,0 +1,67 @@
+#include "../include/fluxion_sched.h"
+#include "fluxion_histogram.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * FLUXION — CLASS STATISTICS IMPLEMENTATION
+ * ============================================================================
+ */
+
+FluxionError fluxion_enable_class_stats(FluxionContext* ctx, int enabled) {
+    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
+
+    if (!enabled) {
+        free(ctx->class_stats);
+        ctx->class_stats = NULL;
+        return FLUXION_OK;
+    }
+
+    if (ctx->class_stats) return FLUXION_OK;
+
+    ctx->class_stats = calloc(FLUXION_PRIORITY_CLASSES, sizeof(FluxionClassStats));
+    if (!ctx->class_stats) {
+        fprintf(stderr, "[Fluxion] Failed to allocate class statistics\n");
+        return FLUXION_ERR_OUT_OF_MEMORY;
+    }
+    return FLUXION_OK;
+}
+
+FluxionClassStats fluxion_class_stats(const FluxionContext* ctx, FluxionPriority priority) {
+    FluxionClassStats none;
+    memset(&none, 0, sizeof(none));
+
+    if (!ctx || !ctx->class_stats || (unsigned)priority >= FLUXION_PRIORITY_CLASSES) return none;
+    return ctx->class_stats[priority];
+}
+
+void fluxion_reset_class_stats(FluxionContext* ctx) {
+    if (ctx && ctx->class_stats) memset(ctx->class_stats, 0, FLUXION_PRIORITY_CLASSES * sizeof(FluxionClassStats));
+}
+
+uint64_t fluxion_class_percentile(const FluxionClassStats* stats, double q) {
+    if (!stats) return 0;
+    return fluxion_histogram_percentile(stats->buckets, stats->runs, stats->max_ns, q);
+}
+
+const char* fluxion_priority_name(FluxionPriority priority) {
+    switch (priority) {
+        case FLUXION_PRIORITY_BULK:     return "BULK";
+        case FLUXION_PRIORITY_NORMAL:   return "NORMAL";
+        case FLUXION_PRIORITY_HIGH:     return "HIGH";
+        case FLUXION_PRIORITY_CRITICAL: return "CRITICAL";
+    }
+    return "UNKNOWN";
+}
+
+void fluxion_class_record(FluxionContext* ctx, const Node* n, uint64_t latency_ns) {
+    FluxionClassStats* s = &ctx->class_stats[n->priority];
+
+    s->runs++;
+    s->total_ns += latency_ns;
+    if (latency_ns > s->max_ns) s->max_ns = latency_ns;
+    if (n->deadline_ns && latency_ns > n->deadline_ns) s->deadline_misses++;
+    s->buckets[fluxion_latency_bucket(latency_ns)]++;
+}
@@ -0,0 +1,356 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_shm.h"
+#include "../include/fluxion_profile.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/* ============================================================================
+ * FLUXION — SHARED STATS IMPLEMENTATION
+ * ============================================================================
+ */
+
+#define FLUXION_SHM_READ_TRIES 1000
+#define FLUXION_SHM_CREATE_GRACE_S 2  // Longest time a segment may stay without its magic
+
+struct FluxionShm {
+    FluxionShmHeader* header;     // Start of the mapping
+    FluxionShmNode* nodes;
+    size_t size;                  // Bytes mapped
+    char* name;                   // Segment name, with its leading '/'
+    Node** graph;
+    size_t count;
+    uint64_t next_ns;             // Earliest next publication
+};
+
+struct FluxionShmReader {
+    const FluxionShmHeader* header;
+    const FluxionShmNode* nodes;
+    size_t size;
+    size_t capacity;
+};
+
+/**
+ * @brief Segment name with a leading '/' (as shm_open() requires)
+ */
+static char* fluxion_shm_name(const char* name) {
+    if (!name || !*name || strchr(name + 1, '/')) return NULL;
+
+    size_t len = strlen(name);
+    char* full = malloc(len + 2);
+    if (!full) return NULL;
+
+    if (name[0] == '/') memcpy(full, name, len + 1);
+    else {
+        full[0] = '/';
+        memcpy(full + 1, name, len + 1);
+    }
+    return full;
+}
+
+static size_t fluxion_shm_size(size_t capacity) {
+    return sizeof(FluxionShmHeader) + capacity * sizeof(FluxionShmNode);
+}
+
+/* ============================================================================
+ * PUBLISHER
+ * ============================================================================
+ */
+
+/**
+ * @brief Writes a snapshot between two increments of the sequence
+ */
+static void fluxion_shm_write(FluxionShm* shm, const FluxionContext* ctx) {
+    FluxionShmHeader* h = shm->header;
+    uint64_t seq = h->seq;
+
+    __atomic_store_n(&h->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    size_t published = 0;
+    for (size_t i = 0; i < shm->count; i++) {
+        Node* n = shm->graph[i];
+        if (!n) continue;
+
+        FluxionShmNode* out = &shm->nodes[published++];
+        FluxionProfileStats p = fluxion_node_profile(n);
+
+        memset(out->name, 0, sizeof(out->name));
+        if (n->name) strncpy(out->name, n->name, sizeof(out->name) - 1);
+        out->state       = (uint32_t)n->state_flag;
+        out->subscribers = (uint32_t)n->subscriber_count;
+        out->transfers   = p.transfers;
+        out->runs        = p.runs;
+        out->total_ns    = p.total_ns;
+        out->p50_ns      = p.p50_ns;
+        out->p99_ns      = p.p99_ns;
+        out->max_ns      = p.max_ns;
+    }
+
+    h->node_count      = (uint32_t)published;
+    h->policy          = (uint32_t)ctx->policy;
+    h->published_ns    = fluxion_time_ns();
+    h->pulse_id        = ctx->current_pulse;
+    h->executed_nodes  = ctx->executed_nodes;
+    h->total_transfers = ctx->edge_transfers;
+    h->pulse_ready     = ctx->pulse_ready;
+    h->pulse_executed  = ctx->pulse_executed;
+    h->last_error      = (int64_t)ctx->last_error;
+
+    __atomic_store_n(&h->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Whether the header of a Fluxion segment is published
+ *
+ * The magic is written last, after a release fence: once it matches,
+ * pid and live are initialized.
+ */
+static int fluxion_shm_has_magic(const FluxionShmHeader* h) {
+    int match = memcmp(h->magic, FLUXION_SHM_MAGIC, sizeof(FLUXION_SHM_MAGIC)) == 0;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return match;
+}
+
+/**
+ * @brief Removes an existing segment if it is stale
+ *
+ * Only a Fluxion segment whose publisher stopped or no longer exists
+ * (a crash) is stale. A zero-filled one is still being created, unless
+ * it is older than FLUXION_SHM_CREATE_GRACE_S (its creator died). The
+ * first process swapping its own pid (negated) into a stale header
+ * unlinks it, so concurrent publishers never remove a fresh segment.
+ * Live publishers, this process's included, and foreign segments are
+ * left alone.
+ *
+ * @return 1 if the name may be created again, 0 if it is in use
+ */
+static int fluxion_shm_reclaim(const char* name) {
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0) return errno == ENOENT;
+
+    struct stat st;
+    int claimed = 0;
+    if (fstat(fd, &st) == 0) {
+        int old = time(NULL) - st.st_ctime > FLUXION_SHM_CREATE_GRACE_S;
+
+        /* Creator died before sizing it: give it a header to claim */
+        if (st.st_size == 0 && old) {
+            if (ftruncate(fd, (off_t)sizeof(FluxionShmHeader)) == 0) st.st_size = sizeof(FluxionShmHeader);
+        }
+
+        if ((size_t)st.st_size >= sizeof(FluxionShmHeader)) {
+            FluxionShmHeader* h = mmap(NULL, sizeof(FluxionShmHeader), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (h != MAP_FAILED) {
+                int published = fluxion_shm_has_magic(h);
+                int64_t pid = __atomic_load_n(&h->pid, __ATOMIC_ACQUIRE);
+                int stale = 0;
+
+                if (published) {
+                    int alive = pid > 0 && (kill((pid_t)pid, 0) == 0 || errno == EPERM);
+                    stale = pid > 0 && (!__atomic_load_n(&h->live, __ATOMIC_ACQUIRE) || !alive);
+                } else {
+                    static const FluxionShmHeader zero;
+                    stale = old && memcmp(h, &zero, sizeof(zero)) == 0;
+                }
+
+                claimed = stale && __atomic_compare_exchange_n(&h->pid, &pid, -(int64_t)getpid(), 0,
+                                                                __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+                munmap(h, sizeof(FluxionShmHeader));
+            }
+        }
+    }
+    close(fd);
+
+    if (claimed) shm_unlink(name);
+    return claimed;
+}
+
+static FluxionShm* fluxion_shm_create(const char* name, Node* graph[], size_t count) {
+    FluxionShm* shm = calloc(1, sizeof(FluxionShm));
+    if (!shm) return NULL;
+
+    shm->name = fluxion_shm_name(name);
+    if (!shm->name) {
+        fprintf(stderr, "[Fluxion] Invalid stats segment name '%s'\n", name ? name : "");
+        free(shm);
+        return NULL;
+    }
+
+    /* A segment left by a crashed process is replaced, a live one is not */
+    int fd = shm_open(shm->name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0 && errno == EEXIST) {
+        if (!fluxion_shm_reclaim(shm->name)) {
+            fprintf(stderr, "[Fluxion] Stats segment '%s' is in use by another publisher\n", shm->name);
+            free(shm->name);
+            free(shm);
+            return NULL;
+        }
+        fd = shm_open(shm->name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    }
+
+    shm->size = fluxion_shm_size(count);
+    void* base = MAP_FAILED;
+    if (fd >= 0 && ftruncate(fd, (off_t)shm->size) == 0) {
+        base = mmap(NULL, shm->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (base == MAP_FAILED) {
+        fprintf(stderr, "[Fluxion] Cannot create stats segment '%s': %s\n", shm->name, strerror(errno));
+        if (fd >= 0) {
+            close(fd);
+            shm_unlink(shm->name);
+        }
+        free(shm->name);
+        free(shm);
+        return NULL;
+    }
+    close(fd);
+
+    /* ftruncate() zero-fills: the sequence starts even */
+    shm->header = base;
+    shm->nodes  = (FluxionShmNode*)(shm->header + 1);
+    shm->graph  = graph;
+    shm->count  = count;
+
+    shm->header->version   = FLUXION_SHM_VERSION;
+    shm->header->node_size = sizeof(FluxionShmNode);
+    shm->header->pid       = (int64_t)getpid();
+    shm->header->live      = 1;
+    shm->header->capacity  = (uint32_t)count;
+
+    /* Last: a probe seeing the magic sees a live publisher */
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(shm->header->magic, FLUXION_SHM_MAGIC, sizeof(FLUXION_SHM_MAGIC));
+    return shm;
+}
+
+void fluxion_shm_destroy(FluxionShm* shm) {
+    if (!shm) return;
+
+    /* Attached readers keep the mapping: they see the publisher stop */
+    shm_unlink(shm->name);
+    FluxionShmHeader* h = shm->header;
+    uint64_t seq = h->seq;
+    __atomic_store_n(&h->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    h->live = 0;
+    __atomic_store_n(&h->seq, seq + 2, __ATOMIC_RELEASE);
+
+    munmap(shm->header, shm->size);
+    free(shm->name);
+    free(shm);
+}
+
+FluxionError fluxion_publish_stats(FluxionContext* ctx, const char* name, Node* graph[], size_t count) {
+    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
+    if (!graph || count > UINT32_MAX) return FLUXION_ERR_INVALID_ARGUMENT;
+
+    fluxion_stop_publishing(ctx);
+    FluxionShm* shm = fluxion_shm_create(name, graph, count);
+    if (!shm) return FLUXION_ERR_INVALID_ARGUMENT;
+
+    ctx->shm = shm;
+    fluxion_shm_write(shm, ctx);
+    shm->next_ns = shm->header->published_ns + FLUXION_SHM_PERIOD_MS * 1000000ULL;
+    return FLUXION_OK;
+}
+
+void fluxion_stop_publishing(FluxionContext* ctx) {
+    if (!ctx || !ctx->shm) return;
+
+    fluxion_shm_destroy(ctx->shm);
+    ctx->shm = NULL;
+}
+
+void fluxion_shm_pulse(FluxionContext* ctx) {
+    FluxionShm* shm = ctx->shm;
+    uint64_t now = fluxion_time_ns();
+    if (now < shm->next_ns) return;
+
+    fluxion_shm_write(shm, ctx);
+    shm->next_ns = now + FLUXION_SHM_PERIOD_MS * 1000000ULL;
+}
+
+/* ============================================================================
+ * READER
+ * ============================================================================
+ */
+
+FluxionShmReader* fluxion_shm_attach(const char* name) {
+    char* full = fluxion_shm_name(name);
+    if (!full) return NULL;
+
+    int fd = shm_open(full, O_RDONLY, 0);
+    free(full);
+    if (fd < 0) return NULL;
+
+    struct stat st;
+    void* base = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(FluxionShmHeader)) {
+        base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (base == MAP_FAILED) return NULL;
+
+    const FluxionShmHeader* h = base;
+    size_t size = (size_t)st.st_size;
+    if (memcmp(h->magic, FLUXION_SHM_MAGIC, sizeof(FLUXION_SHM_MAGIC)) != 0 ||
+        h->version != FLUXION_SHM_VERSION || h->node_size != sizeof(FluxionShmNode) ||
+        fluxion_shm_size(h->capacity) > size) {
+        munmap(base, size);
+        return NULL;
+    }
+
+    FluxionShmReader* r = malloc(sizeof(FluxionShmReader));
+    if (!r) {
+        munmap(base, size);
+        return NULL;
+    }
+    r->header   = h;
+    r->nodes    = (const FluxionShmNode*)(h + 1);
+    r->size     = size;
+    r->capacity = h->capacity;
+    return r;
+}
+
+int fluxion_shm_snapshot(FluxionShmReader* r, FluxionShmHeader* header, FluxionShmNode nodes[], size_t max) {
+    if (!r || !header) return -1;
+
+    for (int tries = 0; tries < FLUXION_SHM_READ_TRIES; tries++) {
+        uint64_t seq = __atomic_load_n(&r->header->seq, __ATOMIC_ACQUIRE);
+        if (seq & 1) {
+            sched_yield();
+            continue;
+        }
+
+        memcpy(header, r->header, sizeof(FluxionShmHeader));
+        size_t count = header->node_count;
+        if (count > r->capacity) count = r->capacity;
+        if (count > max) count = max;
+        if (nodes && count > 0) memcpy(nodes, r->nodes, count * sizeof(FluxionShmNode));
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&r->header->seq, __ATOMIC_RELAXED) == seq) {
+            header->seq = seq;
+            return nodes ? (int)count : 0;
+        }
+    }
+    return -1;
+}
+
+void fluxion_shm_detach(FluxionShmReader* r) {
+    if (!r) return;
+
+    munmap((void*)r->header, r->size);
+    free(r);
+}
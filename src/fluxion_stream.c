@@ -0,0 +1,513 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_stream.h"
+#include "../include/fluxion_plan.h"
+#include "../include/fluxion_join.h"
+#include "fluxion_wait.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* ============================================================================
+ * FLUXION — STREAM CHANNELS (SPSC)
+ *
+ * The producer owns `tail`, the consumer owns `head`; each side caches
+ * the other's index and reloads it only when the queue looks full or
+ * empty, so a steady stream costs one shared store per token and side.
+ * ============================================================================
+ */
+
+#define FLUXION_STREAM_CACHE_LINE 64
+#define FLUXION_STREAM_NO_SOURCE  UINT32_MAX
+
+typedef enum {
+    FLUXION_TOKEN_SKIP = 0,   // The pulse does not reach the consumer through this edge
+    FLUXION_TOKEN_ACTIVE,     // The pulse reaches the consumer with `data`
+    FLUXION_TOKEN_STOP        // The stream shuts down
+} FluxionTokenKind;
+
+typedef struct {
+    void* data;
+    FluxionTokenKind kind;
+} FluxionToken;
+
+struct FluxionStage;
+
+typedef struct {
+    /* --- Producer side --- */
+    size_t tail;
+    size_t head_cache;
+    char pad0[FLUXION_STREAM_CACHE_LINE - 2 * sizeof(size_t)];
+
+    /* --- Consumer side --- */
+    size_t head;
+    size_t tail_cache;
+    char pad1[FLUXION_STREAM_CACHE_LINE - 2 * sizeof(size_t)];
+
+    FluxionToken* slots;
+    size_t mask;
+    struct FluxionStage* producer;
+    struct FluxionStage* consumer;
+} FluxionChannel;
+
+/**
+ * @brief A node and its thread (the feeder is a stage without node)
+ */
+typedef struct FluxionStage {
+    Node* node;
+    FluxionStream* stream;
+
+    FluxionChannel** inputs;
+    uint32_t input_count;
+    FluxionChannel** outputs;
+    uint32_t output_count;
+
+    pthread_t thread;
+    int running;
+    FluxionParker parker;
+
+    uint64_t processed;       // Pulses handled (read by the feeder)
+    uint64_t executed;
+    uint64_t stalls;
+} FluxionStage;
+
+struct FluxionStream {
+    FluxionPlan* plan;        // Topological order and adjacency (owned)
+    FluxionStreamConfig config;
+
+    FluxionStage* stages;     // One per plan node
+    FluxionStage feeder;      // Caller side: produces into the source channels
+
+    FluxionChannel* channels; // Edges, then one ingress channel per source
+    FluxionToken* slots;      // Ring storage of every channel
+    FluxionChannel** links;   // inputs/outputs arrays of every stage
+
+    uint32_t* source_slot;    // Plan index -> source index (or FLUXION_STREAM_NO_SOURCE)
+    uint32_t source_count;
+    FluxionChannel* ingress;  // One channel per source
+    void** pending;           // Payload of each source for the next pulse
+    uint8_t* pending_set;
+    uint32_t pending_count;
+
+    uint64_t submitted;
+};
+
+static int fluxion_channel_readable(const void* arg) {
+    const FluxionChannel* ch = arg;
+    return __atomic_load_n(&ch->tail, __ATOMIC_SEQ_CST) != ch->head;
+}
+
+static int fluxion_channel_writable(const void* arg) {
+    const FluxionChannel* ch = arg;
+    return ch->tail - __atomic_load_n(&ch->head, __ATOMIC_SEQ_CST) <= ch->mask;
+}
+
+/**
+ * @brief Waits until `ready(ch)` holds (spin, yield, then park)
+ */
+static void fluxion_stage_wait(FluxionStage* self, FluxionWaitCondition ready, const FluxionChannel* ch) {
+    const FluxionStreamConfig* c = &self->stream->config;
+    unsigned attempt = 0;
+
+    while (!ready(ch)) {
+        if (fluxion_backoff(c->wait, c->spin_limit, c->yield_limit, attempt)) {
+            fluxion_parker_park(&self->parker, ready, ch);
+        }
+        if (attempt < UINT32_MAX) attempt++;
+    }
+}
+
+static void fluxion_channel_push(FluxionStage* self, FluxionChannel* ch, FluxionToken token) {
+    size_t tail = ch->tail;
+
+    if (tail - ch->head_cache > ch->mask) {
+        ch->head_cache = __atomic_load_n(&ch->head, __ATOMIC_SEQ_CST);
+        if (tail - ch->head_cache > ch->mask) {
+            /* Backpressure: wait for the consumer */
+            __atomic_store_n(&self->stalls, self->stalls + 1, __ATOMIC_RELAXED);
+            fluxion_stage_wait(self, fluxion_channel_writable, ch);
+            ch->head_cache = __atomic_load_n(&ch->head, __ATOMIC_SEQ_CST);
+        }
+    }
+
+    ch->slots[tail & ch->mask] = token;
+    __atomic_store_n(&ch->tail, tail + 1, __ATOMIC_SEQ_CST);
+    fluxion_parker_wake(&ch->consumer->parker);
+}
+
+static FluxionToken fluxion_channel_pop(FluxionStage* self, FluxionChannel* ch) {
+    size_t head = ch->head;
+
+    if (ch->tail_cache == head) {
+        ch->tail_cache = __atomic_load_n(&ch->tail, __ATOMIC_SEQ_CST);
+        if (ch->tail_cache == head) {
+            fluxion_stage_wait(self, fluxion_channel_readable, ch);
+            ch->tail_cache = __atomic_load_n(&ch->tail, __ATOMIC_SEQ_CST);
+        }
+    }
+
+    FluxionToken token = ch->slots[head & ch->mask];
+    __atomic_store_n(&ch->head, head + 1, __ATOMIC_SEQ_CST);
+    fluxion_parker_wake(&ch->producer->parker);
+    return token;
+}
+
+/* ============================================================================
+ * STAGES
+ * ============================================================================
+ */
+
+/**
+ * @brief Stage loop: one token per input and pulse, in submission order
+ *
+ * Every predecessor sends exactly one token per pulse, so collecting
+ * one token from each input yields the whole pulse, after every
+ * predecessor is done with it. The node runs if any token is active
+ * (with the first active payload) and forwards the outcome downstream:
+ * a flow_action's output, or skip when it has none. A join node gets
+ * every active payload in the slot of its edge, and runs only when its
+ * firing policy is met.
+ */
+static void* fluxion_stage_main(void* arg) {
+    FluxionStage* self = arg;
+    Node* n = self->node;
+    uint64_t pulse = 0;
+
+    for (;;) {
+        FluxionToken in = { NULL, FLUXION_TOKEN_SKIP };
+        int stop = 0;
+
+        for (uint32_t i = 0; i < self->input_count; i++) {
+            FluxionToken t = fluxion_channel_pop(self, self->inputs[i]);
+            if (t.kind == FLUXION_TOKEN_STOP) {
+                stop = 1;
+            } else if (t.kind == FLUXION_TOKEN_ACTIVE) {
+                if (n->join) {
+                    int slot = fluxion_join_slot_of(n->join, self->inputs[i]->producer->node);
+                    if (slot >= 0) fluxion_join_deliver(n->join, (uint32_t)slot, t.data, 0, pulse + 1);
+                }
+                if (in.kind != FLUXION_TOKEN_ACTIVE) in = t;
+            }
+        }
+
+        if (stop) {
+            FluxionToken t = { NULL, FLUXION_TOKEN_STOP };
+            for (uint32_t i = 0; i < self->output_count; i++) fluxion_channel_push(self, self->outputs[i], t);
+            break;
+        }
+
+        pulse++;
+        if (in.kind == FLUXION_TOKEN_ACTIVE) {
+            n->input_buffer  = in.data;
+            n->last_pulse_id = pulse;
+            n->state_flag    = FLUXION_NODE_RUNNING;
+            int ran = 1;
+
+            if (n->join_action) {
+                /* Fan-in: fires on the slots, or prunes like a flow_action */
+                uint32_t fresh = n->join ? fluxion_join_ready(n->join, pulse) : 1;
+                void* out = FLUXION_NO_OUTPUT;
+                if (fresh) {
+                    out = n->join_action(n, n->join ? n->join->slots : &n->input_buffer, fresh);
+                    if (n->join) fluxion_join_consume(n->join, NULL);
+                }
+                ran = fresh != 0;
+                if (out == FLUXION_NO_OUTPUT) in.kind = FLUXION_TOKEN_SKIP;
+                in.data = out;
+            } else if (n->async_action) {
+                /* Already off the feeder's thread: the stage itself blocks */
+                void* out = n->async_action(n, in.data);
+                if (out == FLUXION_NO_OUTPUT) in.kind = FLUXION_TOKEN_SKIP;
+                in.data = out;
+            } else if (n->flow_action) {
+                /* Dataflow logic: no output prunes the branch for this pulse */
+                void* out = n->flow_action(n, in.data);
+                if (out == FLUXION_NO_OUTPUT) in.kind = FLUXION_TOKEN_SKIP;
+                in.data = out;
+            } else if (n->action) {
+                n->action(n, in.data);
+            } else if (n->batch_action) {
+                n->batch_action(n, in.data, 1, 0);
+            }
+
+            n->state_flag = FLUXION_NODE_SLEEPING;
+            if (ran) __atomic_store_n(&self->executed, self->executed + 1, __ATOMIC_RELAXED);
+        }
+
+        for (uint32_t i = 0; i < self->output_count; i++) fluxion_channel_push(self, self->outputs[i], in);
+
+        __atomic_store_n(&self->processed, pulse, __ATOMIC_SEQ_CST);
+        fluxion_parker_wake(&self->stream->feeder.parker);
+    }
+
+    return NULL;
+}
+
+/* ============================================================================
+ * CREATION AND SHUTDOWN
+ * ============================================================================
+ */
+
+FluxionStreamConfig fluxion_stream_default_config(void) {
+    FluxionStreamConfig config;
+    config.queue_capacity = 64;
+    config.wait           = FLUXION_WAIT_PARK;
+    config.spin_limit     = 128;
+    config.yield_limit    = 16;
+    return config;
+}
+
+/**
+ * @brief Sends STOP through the graph and joins the stage threads
+ *
+ * Stages that never started are stood in for: their STOP tokens are
+ * pushed from the calling thread, so every running stage gets one on
+ * each input.
+ */
+static void fluxion_stream_stop(FluxionStream* s) {
+    FluxionToken stop = { NULL, FLUXION_TOKEN_STOP };
+    uint32_t n = s->plan->node_count;
+
+    for (uint32_t i = 0; i < s->source_count; i++) {
+        fluxion_channel_push(&s->feeder, &s->ingress[i], stop);
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+        FluxionStage* st = &s->stages[i];
+        if (st->running) continue;
+        for (uint32_t j = 0; j < st->output_count; j++) fluxion_channel_push(&s->feeder, st->outputs[j], stop);
+    }
+
+    for (uint32_t i = 0; i < n; i++) {
+        if (s->stages[i].running) pthread_join(s->stages[i].thread, NULL);
+        s->stages[i].running = 0;
+    }
+}
+
+static void fluxion_stream_free(FluxionStream* s) {
+    if (s->stages) {
+        for (uint32_t i = 0; i < s->plan->node_count; i++) fluxion_parker_destroy(&s->stages[i].parker);
+    }
+    fluxion_parker_destroy(&s->feeder.parker);
+
+    free(s->stages);
+    free(s->channels);
+    free(s->slots);
+    free(s->links);
+    free(s->source_slot);
+    free(s->pending);
+    free(s->pending_set);
+    fluxion_plan_destroy(s->plan);
+    free(s);
+}
+
+FluxionStream* fluxion_stream_create(Node* graph[], size_t count, const FluxionStreamConfig* config) {
+    FluxionPlan* plan = fluxion_plan_compile(graph, count);
+    if (!plan) return NULL;
+
+    FluxionStream* s = calloc(1, sizeof(FluxionStream));
+    if (!s) {
+        fluxion_plan_destroy(plan);
+        return NULL;
+    }
+
+    s->plan   = plan;
+    s->config = config ? *config : fluxion_stream_default_config();
+    if (s->config.queue_capacity == 0) s->config.queue_capacity = fluxion_stream_default_config().queue_capacity;
+
+    size_t capacity = 2;
+    while (capacity < s->config.queue_capacity) capacity *= 2;
+    s->config.queue_capacity = capacity;
+
+    s->feeder.stream = s;
+    fluxion_parker_init(&s->feeder.parker);
+
+    uint32_t n = plan->node_count;
+    uint32_t e = plan->edge_count;
+
+    /* --- Sources: nodes without predecessors --- */
+    uint32_t* in_degree = calloc(n ? n : 1, sizeof(uint32_t));
+    s->source_slot = malloc(sizeof(uint32_t) * (n ? n : 1));
+    if (!in_degree || !s->source_slot) {
+        free(in_degree);
+        fluxion_stream_free(s);
+        return NULL;
+    }
+
+    for (uint32_t k = 0; k < e; k++) in_degree[plan->edge_targets[k]]++;
+    for (uint32_t i = 0; i < n; i++) {
+        s->source_slot[i] = in_degree[i] ? FLUXION_STREAM_NO_SOURCE : s->source_count++;
+    }
+
+    /* --- Stages and channels (edges first, then ingress) --- */
+    size_t channel_count = (size_t)e + s->source_count;
+    s->stages      = calloc(n ? n : 1, sizeof(FluxionStage));
+    s->channels    = calloc(channel_count ? channel_count : 1, sizeof(FluxionChannel));
+    s->slots       = malloc(sizeof(FluxionToken) * capacity * (channel_count ? channel_count : 1));
+    s->links       = malloc(sizeof(FluxionChannel*) * (2 * (size_t)e + s->source_count + 1));
+    s->pending     = calloc(s->source_count + 1, sizeof(void*));
+    s->pending_set = calloc(s->source_count + 1, sizeof(uint8_t));
+
+    if (!s->stages || !s->channels || !s->slots || !s->links || !s->pending || !s->pending_set) {
+        fprintf(stderr, "[Fluxion] Failed to allocate stream (%u stages)\n", n);
+        free(in_degree);
+        if (s->stages) {
+            for (uint32_t i = 0; i < n; i++) fluxion_parker_init(&s->stages[i].parker);
+        }
+        fluxion_stream_free(s);
+        return NULL;
+    }
+
+    s->ingress = s->channels + e;
+    for (size_t c = 0; c < channel_count; c++) {
+        s->channels[c].slots = s->slots + c * capacity;
+        s->channels[c].mask  = capacity - 1;
+    }
+
+    /* Inputs of a stage: ingress (sources) or one slot per in-edge */
+    FluxionChannel** cursor = s->links;
+    for (uint32_t i = 0; i < n; i++) {
+        FluxionStage* st = &s->stages[i];
+        st->node   = plan->nodes[i];
+        st->stream = s;
+        fluxion_parker_init(&st->parker);
+
+        st->inputs = cursor;
+        cursor += in_degree[i] ? in_degree[i] : 1;
+        st->outputs = cursor;
+        st->output_count = plan->edge_offsets[i + 1] - plan->edge_offsets[i];
+        cursor += st->output_count;
+
+        if (s->source_slot[i] != FLUXION_STREAM_NO_SOURCE) {
+            FluxionChannel* ch = &s->ingress[s->source_slot[i]];
+            ch->producer = &s->feeder;
+            ch->consumer = st;
+            st->inputs[st->input_count++] = ch;
+        }
+    }
+    free(in_degree);
+
+    for (uint32_t i = 0; i < n; i++) {
+        FluxionStage* st = &s->stages[i];
+        for (uint32_t k = plan->edge_offsets[i]; k < plan->edge_offsets[i + 1]; k++) {
+            FluxionChannel* ch = &s->channels[k];
+            FluxionStage* dst = &s->stages[plan->edge_targets[k]];
+            ch->producer = st;
+            ch->consumer = dst;
+            st->outputs[k - plan->edge_offsets[i]] = ch;
+            dst->inputs[dst->input_count++] = ch;
+        }
+    }
+
+    /* --- Threads --- */
+    for (uint32_t i = 0; i < n; i++) {
+        if (pthread_create(&s->stages[i].thread, NULL, fluxion_stage_main, &s->stages[i]) != 0) {
+            fprintf(stderr, "[Fluxion] Failed to start stream stage '%s'\n", s->stages[i].node->name);
+            fluxion_stream_stop(s);
+            fluxion_stream_free(s);
+            return NULL;
+        }
+        s->stages[i].running = 1;
+    }
+
+    return s;
+}
+
+void fluxion_stream_destroy(FluxionStream* s) {
+    if (!s) return;
+
+    fluxion_stream_wait(s);
+    fluxion_stream_stop(s);
+    fluxion_stream_free(s);
+}
+
+/* ============================================================================
+ * EMIT, PULSE AND WAIT
+ * ============================================================================
+ */
+
+FluxionError fluxion_stream_emit(FluxionStream* s, Node* target, void* data) {
+    if (!s) return FLUXION_ERR_NULL_CONTEXT;
+    uint32_t index = fluxion_plan_index(s->plan, target);
+    if (index == FLUXION_PLAN_NONE) return FLUXION_ERR_INVALID_NODE;
+
+    uint32_t source = s->source_slot[index];
+    if (source == FLUXION_STREAM_NO_SOURCE) {
+        fprintf(stderr, "[Fluxion] Stream emit rejected: %s has predecessors\n", target->name);
+        return FLUXION_ERR_INVALID_NODE;
+    }
+    if (target->join) {
+        fprintf(stderr, "[Fluxion] Stream emit rejected: %s is a join\n", target->name);
+        return FLUXION_ERR_INVALID_ARGUMENT;
+    }
+
+    /* Already emitted this pulse? */
+    if (s->pending_set[source]) return FLUXION_OK;
+
+    s->pending[source] = data;
+    s->pending_set[source] = 1;
+    s->pending_count++;
+    return FLUXION_OK;
+}
+
+FluxionError fluxion_stream_pulse(FluxionStream* s) {
+    if (!s) return FLUXION_ERR_NULL_CONTEXT;
+    if (s->pending_count == 0) return FLUXION_OK;
+
+    for (uint32_t i = 0; i < s->source_count; i++) {
+        FluxionToken t = { s->pending[i], s->pending_set[i] ? FLUXION_TOKEN_ACTIVE : FLUXION_TOKEN_SKIP };
+        fluxion_channel_push(&s->feeder, &s->ingress[i], t);
+        s->pending[i] = NULL;
+        s->pending_set[i] = 0;
+    }
+
+    s->pending_count = 0;
+    __atomic_store_n(&s->submitted, s->submitted + 1, __ATOMIC_RELAXED);
+    return FLUXION_OK;
+}
+
+/**
+ * @brief Has every stage processed every submitted pulse?
+ */
+static int fluxion_stream_idle(const void* arg) {
+    const FluxionStream* s = arg;
+    for (uint32_t i = 0; i < s->plan->node_count; i++) {
+        if (__atomic_load_n(&s->stages[i].processed, __ATOMIC_SEQ_CST) < s->submitted) return 0;
+    }
+    return 1;
+}
+
+void fluxion_stream_wait(FluxionStream* s) {
+    if (!s) return;
+
+    const FluxionStreamConfig* c = &s->config;
+    unsigned attempt = 0;
+
+    while (!fluxion_stream_idle(s)) {
+        if (fluxion_backoff(c->wait, c->spin_limit, c->yield_limit, attempt)) {
+            fluxion_parker_park(&s->feeder.parker, fluxion_stream_idle, s);
+        }
+        if (attempt < UINT32_MAX) attempt++;
+    }
+}
+
+FluxionStreamStats fluxion_stream_stats(const FluxionStream* s) {
+    FluxionStreamStats stats = {0};
+    if (!s) return stats;
+
+    uint64_t submitted = __atomic_load_n(&s->submitted, __ATOMIC_RELAXED);
+    stats.pulses    = submitted;
+    stats.completed = submitted;
+    stats.stalls    = __atomic_load_n(&s->feeder.stalls, __ATOMIC_RELAXED);
+
+    for (uint32_t i = 0; i < s->plan->node_count; i++) {
+        const FluxionStage* st = &s->stages[i];
+        uint64_t processed = __atomic_load_n(&st->processed, __ATOMIC_RELAXED);
+        if (processed < stats.completed) stats.completed = processed;
+        stats.executed += __atomic_load_n(&st->executed, __ATOMIC_RELAXED);
+        stats.stalls   += __atomic_load_n(&st->stalls, __ATOMIC_RELAXED);
+    }
+
+    return stats;
+}
@@ -1,17 +1,16 @@
 #include "../include/fluxion_tools.h"
+#include "../include/fluxion_cycles.h"
 #include <stdio.h>
-#include <stdlib.h>
-#include <time.h>
 #include <string.h>
 
 /* --- PORTABLE TERMINAL --- */
 #ifdef _WIN32
 #include <windows.h>
-#define CLEAR_SCREEN "cls"
-#else
-#define CLEAR_SCREEN "clear"
 #endif
 
+/* Cursor home + clear to end of screen (VT sequences, see fluxion_setup_terminal()) */
+#define CLEAR_SCREEN "\033[H\033[J"
+
 /* ============================================================================
  * TERMINAL CONFIGURATION
  * ============================================================================
@@ -58,7 +57,8 @@ void fluxion_export_dot(Node* graph[], size_t count, const char* filename) {
                 n->data_type ? n->data_type : "any", fill);
 
         for (size_t j = 0; j < n->subscriber_count; j++) {
-            fprintf(f, "  n%u -> n%u;\n", n->uid, n->subscribers[j]->uid);
+            fprintf(f, "  n%u -> n%u [label=\"%llu\"];\n", n->uid, n->subscribers[j]->uid,
+                    (unsigned long long)(n->edge_transfers ? n->edge_transfers[j] : 0));
         }
     }
 
@@ -72,7 +72,7 @@ void fluxion_export_dot(Node* graph[], size_t count, const char* filename) {
  */
 void fluxion_trace_nodes(Node* graph[], size_t count, FluxionMetrics* metrics) {
     if (!graph) return;
-    system(CLEAR_SCREEN);
+    fputs(CLEAR_SCREEN, stdout);
 
 #ifdef _WIN32
     const char *top = "+----------------------------------------------------+";
@@ -86,6 +86,7 @@ void fluxion_trace_nodes(Node* graph[], size_t count, FluxionMetrics* metrics) {
 
     printf("%s\n%s\n%s\n", top, mid, bot);
 
+    /* States are counted only when no metrics are given */
     size_t ready = 0, running = 0, sleeping = 0;
 
     for (size_t i = 0; i < count; i++) {
@@ -108,64 +109,137 @@ void fluxion_trace_nodes(Node* graph[], size_t count, FluxionMetrics* metrics) {
 
     if (metrics) {
         printf("\nTotal: %zu | Ready: %zu | Running: %zu | Sleeping: %zu | Efficiency: %.2f%%\n",
-               metrics->total_nodes, ready, running, sleeping, metrics->pulse_efficiency);
+               metrics->total_nodes, metrics->ready_nodes, metrics->running_nodes,
+               metrics->sleeping_nodes, metrics->pulse_efficiency);
     } else {
-        double efficiency = (count > 0) ? ((double)running / count) * 100.0 : 0.0;
-        printf("\nTotal: %zu | Ready: %zu | Running: %zu | Sleeping: %zu | Efficiency: %.2f%%\n",
-               count, ready, running, sleeping, efficiency);
+        printf("\nTotal: %zu | Ready: %zu | Running: %zu | Sleeping: %zu\n",
+               count, ready, running, sleeping);
     }
 }
 
 /* ============================================================================
- * CSV LOGGING
+ * METRICS INSPECTION
  * ============================================================================
  */
-void fluxion_enable_logging(FluxionContext* ctx, const char* csv_path) {
-    if (!ctx || !csv_path) return;
-
-    static int header_written = 0;
-    FILE* f = fopen(csv_path, header_written ? "a" : "w");
-    if (!f) return;
-
-    if (!header_written) {
-        fprintf(f, "pulse_id,timestamp,executed_nodes,policy\n");
-        header_written = 1;
+/**
+ * @brief Cycle count of a graph, recomputed only when its topology changed
+ */
+static size_t fluxion_cached_cycles(FluxionContext* ctx, Node* graph[], size_t count) {
+    uint64_t version = fluxion_topology_version();
+    if (ctx->cycle_version == version && ctx->cycle_graph == graph && ctx->cycle_graph_count == count) {
+        return ctx->cycle_count;
     }
 
-    fprintf(f, "%llu,%lu,%llu,%s\n",
-            (unsigned long long)ctx->current_pulse,
-            (unsigned long)time(NULL),
-            (unsigned long long)ctx->executed_nodes,
-            (ctx->policy == FLUXION_EXEC_IMMEDIATE) ? "IMMEDIATE" : "DEFERRED");
+    FluxionCycleReport cycles = fluxion_detect_cycles(graph, count);
+    ctx->cycle_count = cycles.cycle_count;
+    fluxion_cycle_report_free(&cycles);
 
-    fclose(f);
+    ctx->cycle_graph       = graph;
+    ctx->cycle_graph_count = count;
+    ctx->cycle_version     = version;
+    return ctx->cycle_count;
 }
 
-/* ============================================================================
- * METRICS INSPECTION
- * ============================================================================
+/**
+ * @brief No node of any graph of the context is ready or running
  */
-FluxionMetrics fluxion_inspect(FluxionContext* ctx, Node* graph[], size_t count) {
-    FluxionMetrics m = {0};
-    if (!ctx || !graph) return m;
+static int fluxion_context_idle(const FluxionContext* ctx) {
+    return ctx->scheduling == FLUXION_SCHED_READY_QUEUE &&
+           ctx->ready_count == 0 && ctx->ready_list_count == 0 && ctx->flow_count == 0 && ctx->running_nodes == 0;
+}
 
-    m.total_nodes = count;
+static void fluxion_count_states(Node* graph[], size_t count, FluxionMetrics* m) {
     for (size_t i = 0; i < count; i++) {
         Node* n = graph[i];
         if (!n) continue;
+
         switch (n->state_flag) {
-            case FLUXION_NODE_READY:   m.ready_nodes++; break;
-            case FLUXION_NODE_RUNNING: m.running_nodes++; break;
-            case FLUXION_NODE_SLEEPING: m.sleeping_nodes++; break;
+            case FLUXION_NODE_READY:   m->ready_nodes++;    break;
+            case FLUXION_NODE_RUNNING: m->running_nodes++;  break;
+            default:                   m->sleeping_nodes++; break;
         }
     }
+}
 
-    m.total_transfers = ctx->executed_nodes;
-    m.pulse_efficiency = (count > 0) ? ((double)m.running_nodes / count) * 100.0 : 0.0;
+FluxionMetrics fluxion_inspect(FluxionContext* ctx, Node* graph[], size_t count) {
+    FluxionMetrics m = {0};
+    if (!ctx || !graph) return m;
+
+    m.total_nodes = count;
+
+    /*
+     * Context counters span every graph it drives: they only tell that
+     * nothing is pending. A full-scan pulse leaves nodes READY outside
+     * the queue, so its graphs are always counted (as the pulse does).
+     */
+    if (fluxion_context_idle(ctx)) {
+        m.sleeping_nodes = count;
+    } else {
+        fluxion_count_states(graph, count, &m);
+    }
+
+    m.circular_blockages = fluxion_cached_cycles(ctx, graph, count);
+
+    m.total_transfers = ctx->edge_transfers;
+    m.executed_nodes  = ctx->executed_nodes;
+    m.pulse_ready     = ctx->pulse_ready;
+    m.pulse_executed  = ctx->pulse_executed;
+    m.pulse_efficiency = (m.pulse_ready > 0)
+        ? ((double)m.pulse_executed / m.pulse_ready) * 100.0 : 0.0;
 
     return m;
 }
 
+uint64_t fluxion_edge_transfers(const Node* src, const Node* dst) {
+    if (!src || !dst || !src->edge_transfers) return 0;
+
+    for (size_t i = 0; i < src->subscriber_count; i++) {
+        if (src->subscribers[i] == dst) return src->edge_transfers[i];
+    }
+    return 0;
+}
+
+void fluxion_inspect_ingest(FluxionMetrics* metrics, const FluxionIngest* q) {
+    if (!metrics || !q) return;
+
+    FluxionIngestStats stats = fluxion_ingest_stats(q);
+    uint64_t shed = stats.shed_newest + stats.shed_oldest + stats.shed_priority + stats.shed_sampled;
+
+    /* Evicted items were accepted first: they are not offered twice */
+    metrics->ingest_offered  = stats.pushed + stats.rejected + shed - stats.shed_oldest;
+    metrics->ingest_shed     = shed;
+    metrics->ingest_rejected = stats.rejected;
+    metrics->shed_rate = metrics->ingest_offered > 0
+        ? ((double)shed / metrics->ingest_offered) * 100.0 : 0.0;
+}
+
+void fluxion_inspect_profiles(FluxionMetrics* metrics, Node* graph[], size_t count) {
+    if (!metrics) return;
+
+    metrics->hottest_count = fluxion_hottest_nodes(graph, count, metrics->hottest, FLUXION_PROFILE_TOP);
+}
+
+/* ============================================================================
+ * CYCLE REPORT
+ * ============================================================================
+ */
+size_t fluxion_print_cycles(Node* graph[], size_t count) {
+    FluxionCycleReport report = fluxion_detect_cycles(graph, count);
+
+    for (size_t c = 0; c < report.cycle_count; c++) {
+        const FluxionCycle* cycle = &report.cycles[c];
+        printf("\033[1;31m[CYCLE %zu]\033[0m %zu node(s):", c + 1, cycle->count);
+        for (size_t i = 0; i < cycle->count; i++) {
+            printf(" %s", cycle->members[i]->name ? cycle->members[i]->name : "<unnamed>");
+        }
+        printf("\n");
+    }
+
+    size_t found = report.cycle_count;
+    fluxion_cycle_report_free(&report);
+    return found;
+}
+
 /* ============================================================================
  * COLOR UTILITY
  * ============================================================================
@@ -193,5 +267,23 @@ void fluxion_print_summary(const FluxionMetrics* metrics) {
     printf("Running Nodes     : %zu\n", metrics->running_nodes);
     printf("Circular Blockages: %zu\n", metrics->circular_blockages);
     printf("Total Transfers   : %llu\n", (unsigned long long)metrics->total_transfers);
-    printf("Pulse Efficiency  : %.2f%%\n", metrics->pulse_efficiency);
+    printf("Executed Nodes    : %llu\n", (unsigned long long)metrics->executed_nodes);
+    printf("Pulse Efficiency  : %.2f%% (%llu / %llu ready)\n", metrics->pulse_efficiency,
+           (unsigned long long)metrics->pulse_executed, (unsigned long long)metrics->pulse_ready);
+    if (metrics->ingest_offered > 0) {
+        printf("Ingested Items    : %llu\n", (unsigned long long)metrics->ingest_offered);
+        printf("Shed Items        : %llu (%.2f%%)\n", (unsigned long long)metrics->ingest_shed, metrics->shed_rate);
+        printf("Rejected Pushes   : %llu\n", (unsigned long long)metrics->ingest_rejected);
+    }
+    if (metrics->hottest_count > 0) {
+        printf("Hottest Nodes     : runs, p50 / p99 / p999 (us), wait p99 (us)\n");
+        for (size_t i = 0; i < metrics->hottest_count; i++) {
+            const FluxionProfileStats* p = &metrics->hottest[i];
+            printf("  %-16s: %llu, %.1f / %.1f / %.1f, %.1f\n",
+                   p->node->name ? p->node->name : "<unnamed>",
+                   (unsigned long long)p->runs,
+                   p->p50_ns / 1000.0, p->p99_ns / 1000.0, p->p999_ns / 1000.0,
+                   p->wait_p99_ns / 1000.0);
+        }
+    }
 }
@@ -0,0 +1,283 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_trace.h"
+#include "../include/fluxion_profile.h"
+#include "fluxion_clock.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * FLUXION — EXECUTION TRACE
+ *
+ * A lane is written by a single thread at a time (the pulse's thread,
+ * or the pool worker of the same index while a level runs), so spans
+ * are appended with plain stores. Lanes sit on their own cache lines.
+ * The pool's level barrier orders worker spans before the next export.
+ *
+ * Spans hold ticks; the export converts them with the rate measured
+ * between fluxion_start_tracing() and the export.
+ * ============================================================================
+ */
+
+#define FLUXION_CACHE_LINE 64
+
+typedef struct {
+    FluxionTraceSpan* spans;      // Allocated by the first span
+    size_t count;
+    uint64_t dropped;
+    char pad[FLUXION_CACHE_LINE - sizeof(FluxionTraceSpan*) - sizeof(size_t) - sizeof(uint64_t)];
+} FluxionTraceLane;
+
+struct FluxionTracer {
+    FluxionTraceLane lanes[FLUXION_TRACE_LANES];
+    size_t capacity;
+    uint64_t lost;                // Spans of threads without a lane
+    uint64_t start_ticks;         // Clock reading at start, as ticks...
+    uint64_t start_ns;            // ...and as fluxion_time_ns()
+    uint64_t pulse_ticks;         // Start of the running pulse
+};
+
+/* ============================================================================
+ * RECORDING
+ * ============================================================================
+ */
+
+void fluxion_trace_record(
+    FluxionTracer* t,
+    unsigned lane,
+    FluxionTraceKind kind,
+    const char* name,
+    uint64_t pulse_id,
+    uint64_t begin,
+    uint64_t end
+) {
+    if (lane >= FLUXION_TRACE_LANES) {
+        __atomic_add_fetch(&t->lost, 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    FluxionTraceLane* l = &t->lanes[lane];
+    if (!l->spans) {
+        l->spans = malloc(sizeof(FluxionTraceSpan) * t->capacity);
+        if (!l->spans) {
+            l->dropped++;
+            return;
+        }
+    }
+    if (l->count == t->capacity) {
+        l->dropped++;
+        return;
+    }
+
+    FluxionTraceSpan* s = &l->spans[l->count++];
+    s->begin    = begin;
+    s->end      = end;
+    s->pulse_id = pulse_id;
+    s->name     = name;
+    s->kind     = (uint32_t)kind;
+}
+
+size_t fluxion_trace_run(
+    FluxionContext* ctx,
+    Node* n,
+    unsigned lane,
+    size_t (*run)(FluxionContext* ctx, Node* n)
+) {
+    uint64_t begin = fluxion_ticks();
+    size_t executed = run(ctx, n);
+    if (!executed) return 0;
+
+    uint64_t end = fluxion_ticks();
+    if (ctx->tracer) {
+        fluxion_trace_record(ctx->tracer, lane, FLUXION_TRACE_NODE, n->name, ctx->current_pulse, begin, end);
+    }
+
+    /* An async submission is profiled when its job is delivered */
+    if (ctx->profiling && !(n->async_action && !n->join_action)) fluxion_profile_run(n, begin, end);
+    return executed;
+}
+
+void fluxion_trace_begin(FluxionTracer* t) {
+    t->pulse_ticks = fluxion_ticks();
+}
+
+void fluxion_trace_pulse(FluxionTracer* t, uint64_t pulse_id) {
+    fluxion_trace_record(t, 0, FLUXION_TRACE_PULSE, NULL, pulse_id, t->pulse_ticks, fluxion_ticks());
+}
+
+void fluxion_trace_destroy(FluxionTracer* t) {
+    if (!t) return;
+
+    for (unsigned i = 0; i < FLUXION_TRACE_LANES; i++) free(t->lanes[i].spans);
+    free(t);
+}
+
+/* ============================================================================
+ * TRACE API
+ * ============================================================================
+ */
+
+FluxionError fluxion_start_tracing(FluxionContext* ctx, size_t capacity) {
+    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
+
+    void* memory = NULL;
+    if (posix_memalign(&memory, FLUXION_CACHE_LINE, sizeof(FluxionTracer)) != 0) {
+        return FLUXION_ERR_OUT_OF_MEMORY;
+    }
+    FluxionTracer* t = memory;
+    memset(t, 0, sizeof(FluxionTracer));
+
+    t->capacity    = capacity ? capacity : FLUXION_TRACE_CAPACITY;
+    t->start_ns    = fluxion_time_ns();
+    t->start_ticks = fluxion_ticks();
+
+    fluxion_trace_destroy(ctx->tracer);
+    ctx->tracer = t;
+    return FLUXION_OK;
+}
+
+void fluxion_stop_tracing(FluxionContext* ctx) {
+    if (!ctx || !ctx->tracer) return;
+
+    fluxion_trace_destroy(ctx->tracer);
+    ctx->tracer = NULL;
+}
+
+FluxionTraceStats fluxion_trace_stats(const FluxionContext* ctx) {
+    FluxionTraceStats stats = { 0, 0, 0 };
+    if (!ctx || !ctx->tracer) return stats;
+
+    const FluxionTracer* t = ctx->tracer;
+    for (unsigned i = 0; i < FLUXION_TRACE_LANES; i++) {
+        const FluxionTraceLane* l = &t->lanes[i];
+        stats.recorded += l->count;
+        stats.dropped  += l->dropped;
+        if (l->count > 0) stats.lanes++;
+    }
+    stats.dropped += __atomic_load_n(&t->lost, __ATOMIC_RELAXED);
+    return stats;
+}
+
+/* ============================================================================
+ * CHROME TRACE EXPORT
+ * ============================================================================
+ */
+
+/**
+ * @brief A span located in its lane, ordered by pulse then start (flows)
+ */
+typedef struct {
+    uint64_t pulse_id;
+    uint64_t begin;
+    uint32_t lane;
+} FluxionTraceRef;
+
+static int fluxion_trace_ref_cmp(const void* a, const void* b) {
+    const FluxionTraceRef* x = a;
+    const FluxionTraceRef* y = b;
+    if (x->pulse_id != y->pulse_id) return (x->pulse_id > y->pulse_id) - (x->pulse_id < y->pulse_id);
+    return (x->begin > y->begin) - (x->begin < y->begin);
+}
+
+static const char* const fluxion_trace_categories[] = { "pulse", "propagate", "node", "async" };
+
+static void fluxion_trace_string(FILE* f, const char* s) {
+    fputc('"', f);
+    for (; s && *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') fprintf(f, "\\%c", c);
+        else if (c < 0x20) fprintf(f, "\\u%04x", c);
+        else fputc(c, f);
+    }
+    fputc('"', f);
+}
+
+static void fluxion_trace_lane_name(FILE* f, unsigned lane) {
+    fprintf(f, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", lane);
+    if (lane == 0) fprintf(f, "\"pulse thread\"");
+    else if (lane < FLUXION_TRACE_ASYNC_LANE) fprintf(f, "\"worker %u\"", lane);
+    else fprintf(f, "\"async worker %u\"", lane - FLUXION_TRACE_ASYNC_LANE);
+    fprintf(f, "}}");
+}
+
+FluxionError fluxion_export_trace(const FluxionContext* ctx, const char* path) {
+    if (!ctx) return FLUXION_ERR_NULL_CONTEXT;
+    if (!ctx->tracer || !path) return FLUXION_ERR_INVALID_ARGUMENT;
+
+    const FluxionTracer* t = ctx->tracer;
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "[Fluxion] Cannot write trace '%s'\n", path);
+        return FLUXION_ERR_INVALID_ARGUMENT;
+    }
+
+    /* Microseconds since the start of the trace */
+    double us_per_tick = fluxion_ticks_rate(t->start_ticks, t->start_ns, fluxion_ticks(), fluxion_time_ns()) / 1000.0;
+#define FLUXION_TRACE_US(ticks) ((double)(int64_t)((ticks) - t->start_ticks) * us_per_tick)
+
+    fprintf(f, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    fprintf(f, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Fluxion\"}}");
+
+    size_t total = 0;
+    for (unsigned lane = 0; lane < FLUXION_TRACE_LANES; lane++) {
+        const FluxionTraceLane* l = &t->lanes[lane];
+        if (l->count == 0) continue;
+        total += l->count;
+
+        fluxion_trace_lane_name(f, lane);
+        for (size_t i = 0; i < l->count; i++) {
+            const FluxionTraceSpan* s = &l->spans[i];
+            fprintf(f, ",\n{\"name\":");
+            fluxion_trace_string(f, s->name ? s->name : "pulse");
+            fprintf(f, ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u,"
+                       "\"args\":{\"pulse\":%llu}}",
+                    fluxion_trace_categories[s->kind],
+                    FLUXION_TRACE_US(s->begin),
+                    (double)(s->end - s->begin) * us_per_tick,
+                    lane,
+                    (unsigned long long)s->pulse_id);
+        }
+    }
+
+    /* --- Flows: the spans of a pulse, chained by start time --- */
+    FluxionTraceRef* refs = total ? malloc(sizeof(FluxionTraceRef) * total) : NULL;
+    if (refs) {
+        size_t n = 0;
+        for (unsigned lane = 0; lane < FLUXION_TRACE_LANES; lane++) {
+            const FluxionTraceLane* l = &t->lanes[lane];
+            for (size_t i = 0; i < l->count; i++) {
+                refs[n].pulse_id = l->spans[i].pulse_id;
+                refs[n].begin    = l->spans[i].begin;
+                refs[n].lane     = lane;
+                n++;
+            }
+        }
+        qsort(refs, n, sizeof(FluxionTraceRef), fluxion_trace_ref_cmp);
+
+        for (size_t i = 0; i < n; i++) {
+            int first = (i == 0 || refs[i - 1].pulse_id != refs[i].pulse_id);
+            int last  = (i + 1 == n || refs[i + 1].pulse_id != refs[i].pulse_id);
+            if (first && last) continue;
+
+            fprintf(f, ",\n{\"name\":\"pulse\",\"cat\":\"flow\",\"ph\":\"%s\",\"id\":%llu,\"ts\":%.3f,"
+                       "\"pid\":1,\"tid\":%u%s}",
+                    first ? "s" : (last ? "f" : "t"),
+                    (unsigned long long)refs[i].pulse_id,
+                    FLUXION_TRACE_US(refs[i].begin),
+                    refs[i].lane,
+                    first ? "" : ",\"bp\":\"e\"");
+        }
+        free(refs);
+    }
+#undef FLUXION_TRACE_US
+
+    fprintf(f, "\n]}\n");
+    int failed = ferror(f);
+    if (fclose(f) != 0 || failed) {
+        fprintf(stderr, "[Fluxion] Cannot write trace '%s'\n", path);
+        return FLUXION_ERR_INVALID_ARGUMENT;
+    }
+    return FLUXION_OK;
+}
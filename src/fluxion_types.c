@@ -0,0 +1,140 @@
+#include "../include/fluxion_types.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * FLUXION — TYPE REGISTRY
+ * ============================================================================
+ */
+
+#define FLUXION_TYPE_SLOTS (FLUXION_TYPE_MAX * 2)   // Hash slots (power of two)
+
+static FluxionTypeInfo fluxion_types[FLUXION_TYPE_MAX];  // Index 0 = FLUXION_TYPE_NONE
+static FluxionTypeId fluxion_type_slots[FLUXION_TYPE_SLOTS]; // Name hash -> ID (0 = empty)
+static FluxionTypeId fluxion_type_count = 1;
+static int fluxion_type_lock_flag = 0;
+
+static inline void fluxion_type_lock(void) {
+    while (__atomic_test_and_set(&fluxion_type_lock_flag, __ATOMIC_ACQUIRE)) {
+        /* spin: types are interned while graphs are built */
+    }
+}
+
+static inline void fluxion_type_unlock(void) {
+    __atomic_clear(&fluxion_type_lock_flag, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief FNV-1a hash of a name
+ */
+static uint32_t fluxion_type_hash(const char* name) {
+    uint32_t h = 2166136261u;
+    for (const unsigned char* p = (const unsigned char*)name; *p; p++) {
+        h ^= *p;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/**
+ * @brief Slot holding `name`, or the empty slot where it belongs
+ */
+static FluxionTypeId* fluxion_type_slot(const char* name) {
+    uint32_t i = fluxion_type_hash(name) & (FLUXION_TYPE_SLOTS - 1);
+
+    while (fluxion_type_slots[i] &&
+           strcmp(fluxion_types[fluxion_type_slots[i]].name, name) != 0) {
+        i = (i + 1) & (FLUXION_TYPE_SLOTS - 1);
+    }
+    return &fluxion_type_slots[i];
+}
+
+/**
+ * @brief Interns `name` (lock held)
+ *
+ * A new entry gets `size` and `align` before its ID is published.
+ */
+static FluxionTypeId fluxion_type_intern_locked(const char* name, size_t size, size_t align) {
+    FluxionTypeId* slot = fluxion_type_slot(name);
+    if (*slot) return *slot;
+
+    if (fluxion_type_count >= FLUXION_TYPE_MAX) {
+        fprintf(stderr, "[Fluxion] Type registry full, '%s' is left untyped\n", name);
+        return FLUXION_TYPE_NONE;
+    }
+
+    /* The registry owns a copy: callers may pass temporary names */
+    size_t len = strlen(name) + 1;
+    char* copy = malloc(len);
+    if (!copy) return FLUXION_TYPE_NONE;
+    memcpy(copy, name, len);
+
+    FluxionTypeId id = fluxion_type_count;
+    fluxion_types[id].name  = copy;
+    fluxion_types[id].size  = size;
+    fluxion_types[id].align = align;
+    *slot = id;
+
+    /* Publish after the entry is filled (fluxion_type_info() does not lock) */
+    __atomic_store_n(&fluxion_type_count, (FluxionTypeId)(id + 1), __ATOMIC_RELEASE);
+
+    return id;
+}
+
+FluxionTypeId fluxion_type_intern(const char* name) {
+    if (!name) return FLUXION_TYPE_NONE;
+
+    fluxion_type_lock();
+    FluxionTypeId id = fluxion_type_intern_locked(name, 0, 0);
+    fluxion_type_unlock();
+
+    return id;
+}
+
+FluxionTypeId fluxion_type_register(const char* name, size_t size, size_t align) {
+    if (!name) return FLUXION_TYPE_NONE;
+
+    fluxion_type_lock();
+    FluxionTypeId id = fluxion_type_intern_locked(name, size, align);
+
+    if (id != FLUXION_TYPE_NONE) {
+        FluxionTypeInfo* info = &fluxion_types[id];
+
+        if (info->size == 0) {
+            /* Interned earlier without a layout: the size is published last */
+            info->align = align;
+            __atomic_store_n(&info->size, size, __ATOMIC_RELEASE);
+        } else if (info->size != size || info->align != align) {
+            fprintf(stderr,
+                "[Fluxion] Warning: type '%s' already registered with size %zu (got %zu)\n",
+                name, info->size, size);
+        }
+    }
+
+    fluxion_type_unlock();
+    return id;
+}
+
+FluxionTypeId fluxion_type_find(const char* name) {
+    if (!name) return FLUXION_TYPE_NONE;
+
+    fluxion_type_lock();
+    FluxionTypeId id = *fluxion_type_slot(name);
+    fluxion_type_unlock();
+
+    return id;
+}
+
+const FluxionTypeInfo* fluxion_type_info(FluxionTypeId id) {
+    if (id == FLUXION_TYPE_NONE || id >= __atomic_load_n(&fluxion_type_count, __ATOMIC_ACQUIRE)) {
+        return NULL;
+    }
+    return &fluxion_types[id];
+}
+
+size_t fluxion_type_size(FluxionTypeId id) {
+    const FluxionTypeInfo* info = fluxion_type_info(id);
+    return info ? __atomic_load_n(&info->size, __ATOMIC_ACQUIRE) : 0;
+}
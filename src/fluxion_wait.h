@@ -0,0 +1,117 @@
+#ifndef FLUXION_WAIT_H
+#define FLUXION_WAIT_H
+
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#include "../include/fluxion_runtime.h"
+
+/* ============================================================================
+ * FLUXION — WAITING (INTERNAL)
+ *
+ * Shared by the threads of the ingestion queue and of streaming mode:
+ * - Backoff: spin, then yield, then sleep or park (FluxionWaitPolicy)
+ * - Parker: a thread sleeps until another one publishes
+ *
+ * Lost wakeups are ruled out by sequential consistency: the waiter
+ * stores `sleeping` then re-checks its condition, the publisher stores
+ * its update then loads `sleeping`, all with __ATOMIC_SEQ_CST. Either
+ * the waiter sees the update, or the publisher sees the waiter.
+ * ============================================================================
+ */
+
+static inline void fluxion_cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/**
+ * @brief Backoff step
+ * @return 1 if the caller should park (FLUXION_WAIT_PARK, limits exceeded)
+ */
+static inline int fluxion_backoff(
+    FluxionWaitPolicy wait,
+    unsigned spin_limit,
+    unsigned yield_limit,
+    unsigned attempt
+) {
+    if (wait == FLUXION_WAIT_SPIN || attempt < spin_limit) {
+        fluxion_cpu_relax();
+        return 0;
+    }
+    if (wait == FLUXION_WAIT_YIELD || attempt - spin_limit < yield_limit) {
+        sched_yield();
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief Short sleep, for waiters that cannot park
+ */
+static inline void fluxion_backoff_sleep(void) {
+    struct timespec pause = { 0, 50 * 1000 };
+    nanosleep(&pause, NULL);
+}
+
+/* --- PARKER --- */
+
+typedef struct {
+    int sleeping;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+} FluxionParker;
+
+/**
+ * @brief Condition a parked thread waits for (SEQ_CST loads only)
+ */
+typedef int (*FluxionWaitCondition)(const void* arg);
+
+static inline void fluxion_parker_init(FluxionParker* p) {
+    p->sleeping = 0;
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->wake, NULL);
+}
+
+static inline void fluxion_parker_destroy(FluxionParker* p) {
+    pthread_mutex_destroy(&p->lock);
+    pthread_cond_destroy(&p->wake);
+}
+
+/**
+ * @brief Wakes the owner if it is parked (call after a SEQ_CST publication)
+ */
+static inline void fluxion_parker_wake(FluxionParker* p) {
+    if (!__atomic_load_n(&p->sleeping, __ATOMIC_SEQ_CST)) return;
+
+    pthread_mutex_lock(&p->lock);
+    __atomic_store_n(&p->sleeping, 0, __ATOMIC_RELAXED);
+    pthread_cond_signal(&p->wake);
+    pthread_mutex_unlock(&p->lock);
+}
+
+/**
+ * @brief Sleeps until `ready(arg)` holds or the owner is woken
+ * @return 1 if the thread actually slept
+ */
+static inline int fluxion_parker_park(FluxionParker* p, FluxionWaitCondition ready, const void* arg) {
+    int slept = 0;
+    pthread_mutex_lock(&p->lock);
+
+    __atomic_store_n(&p->sleeping, 1, __ATOMIC_SEQ_CST);
+
+    while (__atomic_load_n(&p->sleeping, __ATOMIC_RELAXED) && !ready(arg)) {
+        pthread_cond_wait(&p->wake, &p->lock);
+        slept = 1;
+    }
+
+    __atomic_store_n(&p->sleeping, 0, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&p->lock);
+    return slept;
+}
+
+#endif /* FLUXION_WAIT_H */
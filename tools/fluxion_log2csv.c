@@ -0,0 +1,72 @@
+#include "../include/fluxion_log.h"
+#include <stdio.h>
+#include <string.h>
+
+/* ============================================================================
+ * FLUXION — LOG TO CSV CONVERTER
+ *
+ * Usage: fluxion_log2csv <pulses.flog> [out.csv]
+ *
+ * Converts a binary pulse log (see fluxion_enable_logging()) to CSV,
+ * one line per pulse. Timestamps are wall-clock nanoseconds since the
+ * epoch. The log must come from a host with the same byte order.
+ * ============================================================================
+ */
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "usage: %s <pulses.flog> [out.csv]\n", argv[0]);
+        return 2;
+    }
+
+    FILE* in = fopen(argv[1], "rb");
+    if (!in) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    FluxionLogHeader header;
+    if (fread(&header, sizeof(header), 1, in) != 1 ||
+        memcmp(header.magic, FLUXION_LOG_MAGIC, sizeof(FLUXION_LOG_MAGIC)) != 0) {
+        fprintf(stderr, "%s: not a Fluxion pulse log\n", argv[1]);
+        fclose(in);
+        return 1;
+    }
+    if (header.version != FLUXION_LOG_VERSION || header.record_size != sizeof(FluxionLogRecord)) {
+        fprintf(stderr, "%s: unsupported log version %u (record size %u)\n",
+                argv[1], header.version, header.record_size);
+        fclose(in);
+        return 1;
+    }
+
+    FILE* out = (argc == 3) ? fopen(argv[2], "w") : stdout;
+    if (!out) {
+        perror(argv[2]);
+        fclose(in);
+        return 1;
+    }
+
+    fprintf(out, "pulse_id,timestamp_ns,duration_ns,ready_nodes,executed_nodes,total_executed,policy,last_error\n");
+
+    FluxionLogRecord r;
+    unsigned long long records = 0;
+    while (fread(&r, sizeof(r), 1, in) == 1) {
+        fprintf(out, "%llu,%llu,%llu,%u,%u,%llu,%s,%d\n",
+                (unsigned long long)r.pulse_id,
+                (unsigned long long)(header.realtime_ns + (r.start_ns - header.monotonic_ns)),
+                (unsigned long long)r.duration_ns,
+                r.ready_nodes,
+                r.executed_nodes,
+                (unsigned long long)r.total_executed,
+                fluxion_policy_name((FluxionExecPolicy)r.policy),
+                r.last_error);
+        records++;
+    }
+
+    if (argc == 3) {
+        fclose(out);
+        fprintf(stderr, "%llu pulse(s) written to %s\n", records, argv[2]);
+    }
+    fclose(in);
+    return 0;
+}
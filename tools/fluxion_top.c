@@ -0,0 +1,109 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/fluxion_shm.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* ============================================================================
+ * FLUXION — LIVE MONITOR
+ *
+ * Usage: fluxion_top <segment> [refresh_ms] [frames]
+ *
+ * Attaches to the stats segment of a running process (see
+ * fluxion_publish_stats()) and redraws its counters and nodes every
+ * `refresh_ms` (default 500), `frames` times (default: until the
+ * process stops publishing). Reading never blocks the monitored
+ * process: a frame taken while it writes is simply retried.
+ * ============================================================================
+ */
+
+#define FLUXION_TOP_MAX_NODES 4096
+
+static const char* fluxion_top_state(uint32_t state) {
+    switch (state) {
+        case FLUXION_NODE_SLEEPING: return "\033[1;30mSLEEPING\033[0m";
+        case FLUXION_NODE_READY:    return "\033[1;32mREADY   \033[0m";
+        case FLUXION_NODE_RUNNING:  return "\033[1;33mRUNNING \033[0m";
+    }
+    return "UNKNOWN ";
+}
+
+static void fluxion_top_draw(const FluxionShmHeader* h, const FluxionShmNode* nodes, int count,
+                             double actions_per_s) {
+    uint64_t now = fluxion_time_ns();
+    double age_ms = (now > h->published_ns) ? (now - h->published_ns) / 1e6 : 0.0;
+
+    printf("\033[H\033[J");
+    printf("FLUXION TOP  pid %lld  %s  (snapshot %.0f ms old)\n",
+           (long long)h->pid, h->live ? "running" : "\033[1;31mstopped\033[0m", age_ms);
+    printf("Pulse %llu | Policy %s | Last error %lld\n",
+           (unsigned long long)h->pulse_id, fluxion_policy_name((FluxionExecPolicy)h->policy),
+           (long long)h->last_error);
+    printf("Executed %llu (%.0f/s) | Transfers %llu | Last pulse %llu / %llu ready\n\n",
+           (unsigned long long)h->executed_nodes, actions_per_s,
+           (unsigned long long)h->total_transfers,
+           (unsigned long long)h->pulse_executed, (unsigned long long)h->pulse_ready);
+
+    printf("%-24s %-8s %10s %10s %10s %10s %12s\n",
+           "NODE", "STATE", "RUNS", "P50 us", "P99 us", "MAX us", "TRANSFERS");
+    for (int i = 0; i < count; i++) {
+        const FluxionShmNode* n = &nodes[i];
+        printf("%-24.24s %s %10llu %10.1f %10.1f %10.1f %12llu\n",
+               n->name[0] ? n->name : "<unnamed>",
+               fluxion_top_state(n->state),
+               (unsigned long long)n->runs,
+               n->p50_ns / 1000.0, n->p99_ns / 1000.0, n->max_ns / 1000.0,
+               (unsigned long long)n->transfers);
+    }
+    if ((uint32_t)count < h->node_count) printf("... %u more\n", h->node_count - (uint32_t)count);
+    fflush(stdout);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 4) {
+        fprintf(stderr, "usage: %s <segment> [refresh_ms] [frames]\n", argv[0]);
+        return 2;
+    }
+    long refresh_ms = (argc >= 3) ? atol(argv[2]) : 500;
+    long frames     = (argc == 4) ? atol(argv[3]) : -1;
+    if (refresh_ms <= 0) refresh_ms = 500;
+
+    FluxionShmReader* r = fluxion_shm_attach(argv[1]);
+    if (!r) {
+        fprintf(stderr, "%s: no Fluxion stats segment (is the process publishing?)\n", argv[1]);
+        return 1;
+    }
+
+    FluxionShmNode* nodes = malloc(sizeof(FluxionShmNode) * FLUXION_TOP_MAX_NODES);
+    if (!nodes) {
+        fluxion_shm_detach(r);
+        return 1;
+    }
+
+    FluxionShmHeader h;
+    uint64_t last_executed = 0, last_ns = 0;
+    double rate = 0.0;
+    struct timespec pause = { refresh_ms / 1000, (refresh_ms % 1000) * 1000000L };
+
+    for (long frame = 0; frames < 0 || frame < frames; frame++) {
+        if (frame > 0) nanosleep(&pause, NULL);
+
+        int count = fluxion_shm_snapshot(r, &h, nodes, FLUXION_TOP_MAX_NODES);
+        if (count < 0) continue;
+
+        /* Throughput between two publications */
+        if (h.published_ns > last_ns) {
+            if (last_ns) rate = (double)(h.executed_nodes - last_executed) * 1e9 / (double)(h.published_ns - last_ns);
+            last_executed = h.executed_nodes;
+            last_ns       = h.published_ns;
+        }
+
+        fluxion_top_draw(&h, nodes, count, rate);
+        if (!h.live) break;
+    }
+
+    free(nodes);
+    fluxion_shm_detach(r);
+    return 0;
+}